@@ -0,0 +1,274 @@
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <boost/log/core.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/log/expressions.hpp>
+
+#include "fileio.hpp"
+#include "romloader.hpp"
+#include "memory.hpp"
+#include "interupthandler.hpp"
+#include "timer.hpp"
+#include "instructionhandler.hpp"
+#include "interpreter.hpp"
+#include "blockcache.hpp"
+#include "jit.hpp"
+#include "graphics.hpp"
+#include "scheduler.hpp"
+
+// Instructions per second on a test rom, dispatching through the flat
+// opCode table against the former std::map<uint8_t, shared_ptr> lookup,
+// with eager and lazy flags, over IMemory and the concrete Memory,
+// updating the components after every instruction or when the
+// scheduler finds them due, and through the Interpreter core,
+// with and without the block cache, and the Jit. These three run on
+// the scheduler as Cpu runs them, they are compared with the scheduled
+// table dispatch. GB_PROFILE builds also run the Interpreter with a
+// Profiler.
+
+template <class MEMORY>
+struct BasicMachine
+{
+    BasicMachine()
+        :interruptHandler(memory),
+         timer(memory, interruptHandler),
+         instructionHandler(memory, interruptHandler),
+         interpreter(memory, interruptHandler),
+         graphics(memory, interruptHandler)
+    {}
+
+    void update(int cycles)
+    {
+        if (scheduler != nullptr) {
+            scheduler->update(cycles);
+            return;
+        }
+        timer.update(cycles);
+        graphics.update(cycles);
+        interruptHandler.doInterrupt();
+    }
+
+    void setScheduled()
+    {
+        scheduler.reset(new BasicScheduler<MEMORY>(memory, interruptHandler, timer, graphics));
+    }
+
+    Memory memory;
+    BasicInterruptHandler<MEMORY> interruptHandler;
+    BasicTimer<MEMORY> timer;
+    BasicInstructionHandler<MEMORY> instructionHandler;
+    Interpreter interpreter;
+    BasicGraphics<MEMORY> graphics;
+    std::unique_ptr<BasicScheduler<MEMORY>> scheduler;
+};
+
+using Machine = BasicMachine<IMemory>;
+using DevirtualizedMachine = BasicMachine<Memory>;
+
+template <class MACHINE, class DISPATCH>
+double run(MACHINE& machine, long instructionsToRun, DISPATCH dispatch)
+{
+    auto start = std::chrono::steady_clock::now();
+    long executed = 0;
+    for (; executed < instructionsToRun; executed++) {
+        uint16_t pcValue = machine.memory.get16BitRegister(IMemory::REG16BIT::PC);
+        uint8_t opCode = machine.memory.readInMemory(pcValue);
+        if (opCode == 0x10 || opCode == 0x76 || machine.interruptHandler.isLocked()) {
+            break;
+        }
+        machine.update(dispatch(opCode));
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return executed / elapsed.count();
+}
+
+//the block cache and the Jit update the components themselves,
+//one run is a whole block and they count the instructions run
+template <class MACHINE, class CORE>
+double runBlocks(MACHINE& machine, CORE& core, uint64_t const & executed, long instructionsToRun)
+{
+    auto start = std::chrono::steady_clock::now();
+    while (executed < static_cast<uint64_t>(instructionsToRun)) {
+        uint16_t pcValue = machine.memory.get16BitRegister(IMemory::REG16BIT::PC);
+        uint8_t opCode = machine.memory.readInMemory(pcValue);
+        //HALT and STOP run at the end of a block
+        if (opCode == 0x10 || opCode == 0x76 || machine.interruptHandler.isLocked()
+            || machine.interruptHandler.isHalted()) {
+            break;
+        }
+        core.run();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return executed / elapsed.count();
+}
+
+//flag updates per second for a flag heavy loop: an ADD then
+//a branch reading Z every 4 operations, through IMemory
+template <class SET_FLAGS>
+double runAluFlags(IMemory& memory, long operationsToRun, SET_FLAGS setFlags)
+{
+    auto start = std::chrono::steady_clock::now();
+    long taken = 0;
+    for (long operation = 0; operation < operationsToRun; operation++) {
+        setFlags(memory, static_cast<uint8_t>(operation), static_cast<uint8_t>(operation >> 8));
+        if ((operation & 0x03) == 0 && memory.isSetFlag(IMemory::FLAG::Z)) {
+            taken++;
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (taken < 0) {
+        std::cout << taken;
+    }
+    return operationsToRun / elapsed.count();
+}
+
+int main(int argc, char* argv[])
+{
+    boost::log::core::get()->set_filter(boost::log::trivial::severity >= boost::log::trivial::warning);
+    std::string romName = argc > 1 ? argv[1] : GB_BENCH_ROM;
+    long instructionsToRun = argc > 2 ? std::stol(argv[2]) : 20000000;
+
+    FileIO fileIO;
+    RomLoader romLoader(fileIO);
+    if (!romLoader.load(romName)) {
+        std::cerr << "error loading cartridge " << romName << "\n";
+        return 1;
+    }
+    IMemory::CartridgeData cartridge = romLoader.getData();
+
+    std::unique_ptr<Machine> legacyMachine(new Machine);
+    legacyMachine->memory.setCartridge(cartridge);
+    std::map<uint8_t, std::shared_ptr<IInstructions>> instructions;
+    DispatchTable const & table = legacyMachine->instructionHandler.getDispatchTable();
+    for (int opCode = 0; opCode < 0x100; opCode++) {
+        if (table[opCode] != nullptr) {
+            instructions[opCode] = std::shared_ptr<IInstructions>(table[opCode], [](IInstructions*){});
+        }
+    }
+    double mapSpeed = run(*legacyMachine, instructionsToRun,
+                          [&](uint8_t opCode) {
+                              auto instructMapIt = instructions.find(opCode);
+                              if (instructMapIt == instructions.end()) {
+                                  uint16_t pcValue = legacyMachine->memory.get16BitRegister(IMemory::REG16BIT::PC);
+                                  legacyMachine->interruptHandler.lockUp(pcValue, opCode);
+                                  return 4;
+                              }
+                              std::shared_ptr<IInstructions> instruction = instructMapIt->second;
+                              return instruction->doOp(legacyMachine->memory);
+                          });
+
+    std::unique_ptr<Machine> machine(new Machine);
+    machine->memory.setCartridge(cartridge);
+    double tableSpeed = run(*machine, instructionsToRun,
+                            [&](uint8_t opCode) {
+                                return machine->instructionHandler.doInstruction(opCode);
+                            });
+
+    std::unique_ptr<DevirtualizedMachine> devirtualizedMachine(new DevirtualizedMachine);
+    devirtualizedMachine->memory.setCartridge(cartridge);
+    double devirtualizedSpeed = run(*devirtualizedMachine, instructionsToRun,
+                                    [&](uint8_t opCode) {
+                                        return devirtualizedMachine->instructionHandler.doInstruction(opCode);
+                                    });
+
+    std::unique_ptr<DevirtualizedMachine> scheduledMachine(new DevirtualizedMachine);
+    scheduledMachine->memory.setCartridge(cartridge);
+    scheduledMachine->setScheduled();
+    double scheduledSpeed = run(*scheduledMachine, instructionsToRun,
+                                [&](uint8_t opCode) {
+                                    return scheduledMachine->instructionHandler.doInstruction(opCode);
+                                });
+
+    std::unique_ptr<Machine> lazyMachine(new Machine);
+    lazyMachine->memory.setCartridge(cartridge);
+    lazyMachine->memory.setLazyFlags(true);
+    double lazySpeed = run(*lazyMachine, instructionsToRun,
+                           [&](uint8_t opCode) {
+                               return lazyMachine->instructionHandler.doInstruction(opCode);
+                           });
+
+    std::unique_ptr<DevirtualizedMachine> interpreterMachine(new DevirtualizedMachine);
+    interpreterMachine->memory.setCartridge(cartridge);
+    interpreterMachine->setScheduled();
+    double interpreterSpeed = run(*interpreterMachine, instructionsToRun,
+                                  [&](uint8_t opCode) {
+                                      return interpreterMachine->interpreter.doInstruction(opCode);
+                                  });
+#if GB_PROFILE
+    std::unique_ptr<DevirtualizedMachine> profiledMachine(new DevirtualizedMachine);
+    std::unique_ptr<Profiler> profiler(new Profiler);
+    profiledMachine->interpreter.setProfiler(profiler.get());
+    profiledMachine->memory.setCartridge(cartridge);
+    profiledMachine->setScheduled();
+    double profiledSpeed = run(*profiledMachine, instructionsToRun,
+                               [&](uint8_t opCode) {
+                                   return profiledMachine->interpreter.doInstruction(opCode);
+                               });
+#endif
+
+    std::unique_ptr<DevirtualizedMachine> blockCacheMachine(new DevirtualizedMachine);
+    blockCacheMachine->setScheduled();
+    //a Memory reports its writes to a single code cache
+    BlockCache blockCache(blockCacheMachine->memory, blockCacheMachine->interruptHandler);
+    blockCache.setScheduler(blockCacheMachine->scheduler.get());
+    blockCacheMachine->memory.setCartridge(cartridge);
+    BlockCache::Stats const & stats = blockCache.getStats();
+    double blockCacheSpeed = runBlocks(*blockCacheMachine, blockCache, stats.instructions, instructionsToRun);
+
+    std::unique_ptr<DevirtualizedMachine> jitMachine(new DevirtualizedMachine);
+    jitMachine->setScheduled();
+    Jit jit(jitMachine->memory, jitMachine->interruptHandler);
+    jit.setScheduler(jitMachine->scheduler.get());
+    jitMachine->memory.setCartridge(cartridge);
+    Jit::NativeStats const & jitStats = jit.getNativeStats();
+    double jitSpeed = runBlocks(*jitMachine, jit, jit.getStats().instructions, instructionsToRun);
+
+    std::unique_ptr<Memory> eagerFlags(new Memory);
+    std::unique_ptr<Memory> lazyFlags(new Memory);
+    lazyFlags->setLazyFlags(true);
+    long const aluOperations = 20000000;
+    double perFlagSpeed = runAluFlags(*eagerFlags, aluOperations,
+                                      [](IMemory& memory, uint8_t value, uint8_t operand) {
+                                          memory.IMemory::setAluFlags(IMemory::ALU_OPERATION::ADD, value, operand);
+                                      });
+    double eagerFlagsSpeed = runAluFlags(*eagerFlags, aluOperations,
+                                         [](IMemory& memory, uint8_t value, uint8_t operand) {
+                                             memory.setAluFlags(IMemory::ALU_OPERATION::ADD, value, operand);
+                                         });
+    double lazyFlagsSpeed = runAluFlags(*lazyFlags, aluOperations,
+                                        [](IMemory& memory, uint8_t value, uint8_t operand) {
+                                            memory.setAluFlags(IMemory::ALU_OPERATION::ADD, value, operand);
+                                        });
+
+    std::cout << "map dispatch   : " << static_cast<long>(mapSpeed) << " instructions/s\n"
+              << "table dispatch : " << static_cast<long>(tableSpeed) << " instructions/s\n"
+              << "gain           : " << (tableSpeed / mapSpeed - 1.0) * 100.0 << " %\n"
+              << "devirtualized  : " << static_cast<long>(devirtualizedSpeed) << " instructions/s\n"
+              << "gain           : " << (devirtualizedSpeed / tableSpeed - 1.0) * 100.0 << " % over table\n"
+              << "scheduled      : " << static_cast<long>(scheduledSpeed) << " instructions/s\n"
+              << "gain           : " << (scheduledSpeed / devirtualizedSpeed - 1.0) * 100.0 << " % over devirtualized\n"
+              << "lazy flags     : " << static_cast<long>(lazySpeed) << " instructions/s\n"
+              << "gain           : " << (lazySpeed / tableSpeed - 1.0) * 100.0 << " % over table\n"
+              << "per flag alu   : " << static_cast<long>(perFlagSpeed) << " operations/s\n"
+              << "eager alu      : " << static_cast<long>(eagerFlagsSpeed) << " operations/s\n"
+              << "lazy alu       : " << static_cast<long>(lazyFlagsSpeed) << " operations/s\n"
+              << "gain           : " << (lazyFlagsSpeed / perFlagSpeed - 1.0) * 100.0 << " % over per flag\n"
+              << "interpreter    : " << static_cast<long>(interpreterSpeed) << " instructions/s\n"
+              << "gain           : " << (interpreterSpeed / scheduledSpeed - 1.0) * 100.0 << " % over scheduled\n"
+#if GB_PROFILE
+              << "profiled       : " << static_cast<long>(profiledSpeed) << " instructions/s\n"
+              << "cost           : " << (1.0 - profiledSpeed / interpreterSpeed) * 100.0 << " % of interpreter\n"
+#endif
+              << "block cache    : " << static_cast<long>(blockCacheSpeed) << " instructions/s\n"
+              << "gain           : " << (blockCacheSpeed / interpreterSpeed - 1.0) * 100.0 << " % over interpreter\n"
+              << "blocks         : " << stats.blocks << ", hit rate " << stats.getHitRate() * 100.0
+              << " %, " << stats.invalidations << " invalidated\n"
+              << "jit            : " << static_cast<long>(jitSpeed) << " instructions/s\n"
+              << "gain           : " << (jitSpeed / interpreterSpeed - 1.0) * 100.0 << " % over interpreter\n"
+              << "compiled       : " << jitStats.compiledBlocks << " blocks, "
+              << jitStats.nativeRuns << " native runs\n";
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+
+#include "memory.hpp"
+
+// Register accesses per second, through the former
+// std::map<REG8BIT, uint8_t*> lookup, the register arrays of Memory
+// behind IMemory and on the concrete Memory, and the Registers fields.
+
+//the lookup Memory did before, operator[] on every access
+struct MapRegisters
+{
+    MapRegisters()
+    {
+        _8BitRegisters = {
+            {IMemory::REG8BIT::A, &registers.a}, {IMemory::REG8BIT::F, &registers.f},
+            {IMemory::REG8BIT::B, &registers.b}, {IMemory::REG8BIT::C, &registers.c},
+            {IMemory::REG8BIT::D, &registers.d}, {IMemory::REG8BIT::E, &registers.e},
+            {IMemory::REG8BIT::H, &registers.h}, {IMemory::REG8BIT::L, &registers.l}};
+        _16BitRegisters = {
+            {IMemory::REG16BIT::AF, &registers.af}, {IMemory::REG16BIT::BC, &registers.bc},
+            {IMemory::REG16BIT::DE, &registers.de}, {IMemory::REG16BIT::HL, &registers.hl},
+            {IMemory::REG16BIT::SP, &registers.sp}, {IMemory::REG16BIT::PC, &registers.pc}};
+    }
+
+    uint8_t get8BitRegister(IMemory::REG8BIT reg) { return *_8BitRegisters[reg]; }
+    void set8BitRegister(IMemory::REG8BIT reg, uint8_t value) { *_8BitRegisters[reg] = value; }
+    uint16_t get16BitRegister(IMemory::REG16BIT reg) { return *_16BitRegisters[reg]; }
+    void set16BitRegister(IMemory::REG16BIT reg, uint16_t value) { *_16BitRegisters[reg] = value; }
+
+    Registers registers{};
+    std::map<IMemory::REG8BIT, uint8_t*> _8BitRegisters;
+    std::map<IMemory::REG16BIT, uint16_t*> _16BitRegisters;
+};
+
+//what an instruction does with its registers: an ld r,r', an inc rr
+//and the PC increment, F is left out to keep the lazy flags apart
+template <class REGISTERS>
+double run(REGISTERS& registers, long operationsToRun)
+{
+    static IMemory::REG8BIT const regs[] = {
+        IMemory::REG8BIT::A, IMemory::REG8BIT::B, IMemory::REG8BIT::C, IMemory::REG8BIT::D,
+        IMemory::REG8BIT::E, IMemory::REG8BIT::H, IMemory::REG8BIT::L, IMemory::REG8BIT::B};
+    auto start = std::chrono::steady_clock::now();
+    for (long operation = 0; operation < operationsToRun; operation++) {
+        IMemory::REG8BIT destination = regs[operation & 0x07];
+        IMemory::REG8BIT source = regs[(operation >> 3) & 0x07];
+        registers.set8BitRegister(destination, registers.get8BitRegister(source) + 1);
+        registers.set16BitRegister(IMemory::REG16BIT::HL,
+                                   registers.get16BitRegister(IMemory::REG16BIT::HL) + 1);
+        registers.set16BitRegister(IMemory::REG16BIT::PC,
+                                   registers.get16BitRegister(IMemory::REG16BIT::PC) + 1);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (registers.get16BitRegister(IMemory::REG16BIT::PC) == 0x1234) {
+        std::cout << " ";
+    }
+    return operationsToRun / elapsed.count();
+}
+
+//the same operations on the fields, the upper bound
+double runFields(Registers& registers, long operationsToRun)
+{
+    uint8_t* fields[] = {
+        &registers.a, &registers.b, &registers.c, &registers.d,
+        &registers.e, &registers.h, &registers.l, &registers.b};
+    auto start = std::chrono::steady_clock::now();
+    for (long operation = 0; operation < operationsToRun; operation++) {
+        *fields[operation & 0x07] = *fields[(operation >> 3) & 0x07] + 1;
+        registers.hl++;
+        registers.pc++;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    if (registers.pc == 0x1234) {
+        std::cout << " ";
+    }
+    return operationsToRun / elapsed.count();
+}
+
+int main(int argc, char* argv[])
+{
+    long operationsToRun = argc > 1 ? std::stol(argv[1]) : 50000000;
+
+    std::unique_ptr<MapRegisters> mapRegisters(new MapRegisters);
+    double mapSpeed = run(*mapRegisters, operationsToRun);
+
+    std::unique_ptr<Memory> memory(new Memory);
+    IMemory& interfaceMemory = *memory;
+    double interfaceSpeed = run(interfaceMemory, operationsToRun);
+    double memorySpeed = run(*memory, operationsToRun);
+
+    std::unique_ptr<Registers> registers(new Registers{});
+    double fieldSpeed = runFields(*registers, operationsToRun);
+
+    std::cout << "std::map lookup : " << mapSpeed << " operations/s\n"
+              << "IMemory         : " << interfaceSpeed << " operations/s\n"
+              << "Memory          : " << memorySpeed << " operations/s\n"
+              << "gain            : " << (memorySpeed / mapSpeed - 1) * 100 << " % over std::map\n"
+              << "fields          : " << fieldSpeed << " operations/s\n";
+    return 0;
+}
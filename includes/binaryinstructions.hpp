@@ -1,19 +1,18 @@
 #ifndef _BINARYINSTRUCTIONS_
 #define _BINARYINSTRUCTIONS_
 
-#include <iostream>
-#include <bitset>
 #include "iinstructions.hpp"
 
-class SET : public IInstructions
+template <class MEMORY>
+class SET : public BasicInstructions<MEMORY>
 {
 public:
     SET (int cycles, int bit, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _bit(bit),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         memory.setBitInRegister(_bit, _reg8Bit);
     }
 
@@ -22,35 +21,34 @@ private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class SET_ARR : public IInstructions
+template <class MEMORY>
+class SET_ARR : public BasicInstructions<MEMORY>
 {
 public:
     SET_ARR (int cycles, int bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _bit(bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t value = memory.readInMemory(adress);
-        std::bitset<8> bitsetValue(value);
-        bitsetValue[_bit] = 1;
-        uint8_t newValue = static_cast<uint8_t>(bitsetValue.to_ulong());
-        memory.writeInMemory(newValue, adress);
+        memory.writeInMemory(value | (1 << _bit), adress);
     }
 
 private:
     int _bit;
 };
 
-class RES : public IInstructions
+template <class MEMORY>
+class RES : public BasicInstructions<MEMORY>
 {
 public:
     RES (int cycles, int bit, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _bit(bit),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         memory.unsetBitInRegister(_bit, _reg8Bit);
     }
 
@@ -59,41 +57,35 @@ private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class RES_ARR : public IInstructions
+template <class MEMORY>
+class RES_ARR : public BasicInstructions<MEMORY>
 {
 public:
     RES_ARR (int cycles, int bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _bit(bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t value = memory.readInMemory(adress);
-        std::bitset<8> bitsetValue(value);
-        bitsetValue[_bit] = 0;
-        uint8_t newValue = static_cast<uint8_t>(bitsetValue.to_ulong());
-        memory.writeInMemory(newValue, adress);
+        memory.writeInMemory(value & ~(1 << _bit), adress);
     }
 
 private:
     int _bit;
 };
 
-class BIT : public IInstructions
+template <class MEMORY>
+class BIT : public BasicInstructions<MEMORY>
 {
 public:
     BIT (int cycles, int bit, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _bit(bit),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        if (memory.isSet(_bit, _reg8Bit)) {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
+    void doInstructionImpl(MEMORY& memory) override {
+        this->setFlag(memory, IMemory::FLAG::Z, !memory.isSet(_bit, _reg8Bit));
         memory.unsetFlag(IMemory::FLAG::N);
         memory.setFlag(IMemory::FLAG::H);
     }
@@ -103,23 +95,18 @@ private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class BIT_ARR : public IInstructions
+template <class MEMORY>
+class BIT_ARR : public BasicInstructions<MEMORY>
 {
 public:
     BIT_ARR (int cycles, int bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _bit(bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t value = memory.readInMemory(adress);
-        std::bitset<8> bitsetValue(value);
-        if (bitsetValue[_bit] == 0) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
+        this->setFlag(memory, IMemory::FLAG::Z, (value & (1 << _bit)) == 0);
         memory.unsetFlag(IMemory::FLAG::N);
         memory.setFlag(IMemory::FLAG::H);
     }
@@ -128,573 +115,255 @@ private:
     int _bit;
 };
 
-class RLC : public IInstructions
+template <class MEMORY>
+class RLC : public BasicInstructions<MEMORY>
 {
 public:
     RLC (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate << 1;
-        if(isSet) {
-            bitsetToRotate[0] = 1;
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(_reg8Bit, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, (value << 1) | (value >> 7), value & 0x80));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class RLC_ARR : public IInstructions
+template <class MEMORY>
+class RLC_ARR : public BasicInstructions<MEMORY>
 {
 public:
     RLC_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate << 1;
-        if(isSet) {
-            bitsetToRotate[0] = 1;
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.writeInMemory(rotatedValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        memory.writeInMemory(this->setShiftFlags(memory, (value << 1) | (value >> 7), value & 0x80), adress);
     }
 };
 
-class RRC : public IInstructions
+template <class MEMORY>
+class RRC : public BasicInstructions<MEMORY>
 {
 public:
     RRC (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bitsetToRotate = bitsetToRotate >> 1;
-        if(isSet) {
-            bitsetToRotate[7] = 1;
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(_reg8Bit, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, (value >> 1) | (value << 7), value & 0x01));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class RRC_ARR : public IInstructions
+template <class MEMORY>
+class RRC_ARR : public BasicInstructions<MEMORY>
 {
 public:
     RRC_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bitsetToRotate = bitsetToRotate >> 1;
-        if(isSet) {
-            bitsetToRotate[7] = 1;
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.writeInMemory(rotatedValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        memory.writeInMemory(this->setShiftFlags(memory, (value >> 1) | (value << 7), value & 0x01), adress);
     }
 };
 
-class RL : public IInstructions
+template <class MEMORY>
+class RL : public BasicInstructions<MEMORY>
 {
 public:
     RL (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate << 1;
-        int carryValue = memory.isSetFlag(IMemory::FLAG::C);
-        bitsetToRotate[0] = carryValue;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(_reg8Bit, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        uint8_t carry = memory.isSetFlag(IMemory::FLAG::C);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, (value << 1) | carry, value & 0x80));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class RL_ARR : public IInstructions
+template <class MEMORY>
+class RL_ARR : public BasicInstructions<MEMORY>
 {
 public:
     RL_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate << 1;
-        int carryValue = memory.isSetFlag(IMemory::FLAG::C);
-        bitsetToRotate[0] = carryValue;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.writeInMemory(rotatedValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        uint8_t carry = memory.isSetFlag(IMemory::FLAG::C);
+        memory.writeInMemory(this->setShiftFlags(memory, (value << 1) | carry, value & 0x80), adress);
     }
 };
 
-class RR : public IInstructions
+template <class MEMORY>
+class RR : public BasicInstructions<MEMORY>
 {
 public:
     RR (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bitsetToRotate = bitsetToRotate >> 1;
-        int carryValue = memory.isSetFlag(IMemory::FLAG::C);
-        bitsetToRotate[7] = carryValue;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(_reg8Bit, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        uint8_t carry = memory.isSetFlag(IMemory::FLAG::C);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, (value >> 1) | (carry << 7), value & 0x01));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class RR_ARR : public IInstructions
+template <class MEMORY>
+class RR_ARR : public BasicInstructions<MEMORY>
 {
 public:
     RR_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bitsetToRotate = bitsetToRotate >> 1;
-        int carryValue = memory.isSetFlag(IMemory::FLAG::C);
-        bitsetToRotate[7] = carryValue;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.writeInMemory(rotatedValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        uint8_t carry = memory.isSetFlag(IMemory::FLAG::C);
+        memory.writeInMemory(this->setShiftFlags(memory, (value >> 1) | (carry << 7), value & 0x01), adress);
     }
 };
 
-class SLA : public IInstructions
+template <class MEMORY>
+class SLA : public BasicInstructions<MEMORY>
 {
 public:
     SLA (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate << 1;
-        bitsetToRotate[0] = 0;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(_reg8Bit, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, value << 1, value & 0x80));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class SLA_ARR : public IInstructions
+template <class MEMORY>
+class SLA_ARR : public BasicInstructions<MEMORY>
 {
 public:
     SLA_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate << 1;
-        bitsetToRotate[0] = 0;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.writeInMemory(rotatedValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        memory.writeInMemory(this->setShiftFlags(memory, value << 1, value & 0x80), adress);
     }
 };
 
-class SRA : public IInstructions
+template <class MEMORY>
+class SRA : public BasicInstructions<MEMORY>
 {
 public:
     SRA (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bool carryValue = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate >> 1;
-        bitsetToRotate[7] = carryValue;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(_reg8Bit, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, (value >> 1) | (value & 0x80), value & 0x01));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class SRA_ARR : public IInstructions
+template <class MEMORY>
+class SRA_ARR : public BasicInstructions<MEMORY>
 {
 public:
     SRA_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bool carryValue = bitsetToRotate[7];
-        bitsetToRotate = bitsetToRotate >> 1;
-        bitsetToRotate[7] = carryValue;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.writeInMemory(rotatedValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        memory.writeInMemory(this->setShiftFlags(memory, (value >> 1) | (value & 0x80), value & 0x01), adress);
     }
 };
 
-class SRL : public IInstructions
+template <class MEMORY>
+class SRL : public BasicInstructions<MEMORY>
 {
 public:
     SRL (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bitsetToRotate = bitsetToRotate >> 1;
-        bitsetToRotate[7] = 0;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(_reg8Bit, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, value >> 1, value & 0x01));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class SRL_ARR : public IInstructions
+template <class MEMORY>
+class SRL_ARR : public BasicInstructions<MEMORY>
 {
 public:
     SRL_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        std::bitset<8> bitsetToRotate(regValue);
-
-        bool isSet = bitsetToRotate[0];
-        bitsetToRotate = bitsetToRotate >> 1;
-        bitsetToRotate[7] = 0;
-        if(isSet) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetToRotate.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.writeInMemory(rotatedValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        memory.writeInMemory(this->setShiftFlags(memory, value >> 1, value & 0x01), adress);
     }
 };
 
-class SWAP : public IInstructions
+template <class MEMORY>
+class SWAP : public BasicInstructions<MEMORY>
 {
 public:
     SWAP (int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regValue = memory.get8BitRegister(_reg8Bit);
-        uint8_t newValue =(regValue << 4) | (regValue >> 4);
-
-        if (newValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-        memory.unsetFlag(IMemory::FLAG::C);
-
-        memory.set8BitRegister(_reg8Bit, newValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(_reg8Bit);
+        memory.set8BitRegister(_reg8Bit, this->setShiftFlags(memory, (value << 4) | (value >> 4), false));
     }
 
 private:
     IMemory::REG8BIT _reg8Bit;
 };
 
-class SWAP_ARR : public IInstructions
+template <class MEMORY>
+class SWAP_ARR : public BasicInstructions<MEMORY>
 {
 public:
     SWAP_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
-        uint8_t regValue = memory.readInMemory(adress);
-        uint8_t newValue =(regValue << 4) | (regValue >> 4);
-
-        if (newValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-        memory.unsetFlag(IMemory::FLAG::C);
-
-        memory.writeInMemory(newValue, adress);
+        uint8_t value = memory.readInMemory(adress);
+        memory.writeInMemory(this->setShiftFlags(memory, (value << 4) | (value >> 4), false), adress);
     }
 };
 #endif /*BINARYINSTRUCTIONS*/
@@ -0,0 +1,119 @@
+#ifndef _BLOCKCACHE_
+#define _BLOCKCACHE_
+
+#include <memory>
+#include <vector>
+#include "icodecache.hpp"
+#include "iinstructionhandler.hpp"
+#include "iinterupthandler.hpp"
+#include "interpreter.hpp"
+#include "memory.hpp"
+#include "scheduler.hpp"
+
+//Interpreter core replaying pre-decoded straight-line runs of instructions.
+//A block is decoded once at its start PC and kept until one of its bytes
+//is written or a new cartridge is loaded. run goes through a whole block
+//and moves the scheduler after each instruction, so the state seen by the
+//components is the same as stepping them one at a time.
+//Frequent pairs and triples are marked when decoded and run as one
+//superinstruction when no event is due before they end.
+class BlockCache : public IInstructionHandler, public ICodeCache
+{
+public:
+
+    enum class FUSION : uint8_t
+        {
+            NONE,
+            ALU_JUMP_RELATIVE,
+            COPY_BYTE,
+            LOAD_COMPARE,
+            LOAD_COMPARE_JUMP
+        };
+
+    struct MicroOp
+    {
+        uint16_t pc;
+        uint16_t operand;
+        uint8_t opCode;
+        //superinstruction starting here, with the following microOps
+        FUSION fusion;
+        uint8_t fusedLength;
+        //cycles of the whole superinstruction, branch taken
+        uint8_t fusedCycles;
+    };
+
+    struct Block
+    {
+        uint16_t startPc;
+        uint16_t size;
+        std::vector<MicroOp> microOps;
+    };
+
+    struct Stats
+    {
+        uint64_t lookups = 0;
+        uint64_t hits = 0;
+        uint64_t invalidations = 0;
+        uint32_t blocks = 0;
+        uint64_t fusedRuns = 0;
+        //run by run, a superinstruction counts all of its own,
+        //the Jit counts the native ones too
+        uint64_t instructions = 0;
+
+        double getHitRate() const
+        {
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / lookups;
+        }
+    };
+
+    BlockCache(Memory& memory, IInterruptHandler& interruptHandler);
+    ~BlockCache();
+
+    //one instruction on the Interpreter, the blocks only serve run
+    int doInstruction(uint8_t opCode) override;
+    //runs the block at PC (one instruction outside cacheable memory) and
+    //updates the components through the scheduler, returns the cycles spent.
+    //STOP and HALT end a block, waiting while halted is left to the caller
+    virtual int run();
+    //the blocks the JIT runs natively are not recorded,
+    //nor the superinstructions, they are left off while profiling
+    void setProfiler(Profiler* profiler) override;
+    //run needs one, it tells when the next event is due
+    void setScheduler(BasicScheduler<Memory>* scheduler);
+    void invalidate(uint16_t adress) override;
+    void clear() override;
+    Stats const & getStats() const;
+
+    //bytes, also bounds how far back invalidate has to look
+    static uint16_t const _maxBlockSize = 64;
+    //code above runs uncached, IO registers change without writeInMemory
+    static uint16_t const _cacheableEnd = 0xfe00;
+
+protected:
+
+    Block* findBlock(uint16_t pc);
+    virtual void removeBlock(uint16_t startPc);
+    int runBlock(Block const & block);
+
+    Memory& _memory;
+    Registers& _registers;
+    Interpreter _interpreter;
+    std::vector<std::unique_ptr<Block>> _blocks;
+    BasicScheduler<Memory>* _scheduler = nullptr;
+    Stats _stats;
+
+    //a write in the running block removes it, the run stops after that write
+    Block const * _runningBlock = nullptr;
+    bool _isRunningBlockRemoved = false;
+
+private:
+
+    std::unique_ptr<Block> decodeBlock(uint16_t pc);
+    static bool isEndOfBlock(uint8_t opCode);
+    static void fuse(std::vector<MicroOp>& microOps);
+    bool isFusable(MicroOp const * microOps) const;
+    int runFused(MicroOp const * microOps);
+
+    bool _isProfiling = false;
+};
+#endif /*BLOCKCACHE*/
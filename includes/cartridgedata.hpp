@@ -0,0 +1,39 @@
+#ifndef _CARTRIDGEDATA_
+#define _CARTRIDGEDATA_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+//The bytes of a cartridge: a sized read only view and what keeps it
+//alive, the mapped rom file or an owned buffer. Copies share the bytes,
+//so one costs a reference count whatever the rom size.
+class CartridgeData
+{
+public:
+
+    CartridgeData() = default;
+    //owns the bytes
+    explicit CartridgeData(std::vector<uint8_t> bytes);
+    //data stays valid as long as owner
+    CartridgeData(std::shared_ptr<void const> owner, uint8_t const * data, size_t size);
+
+    uint8_t const * data() const;
+    size_t size() const;
+    bool empty() const;
+    uint8_t const * begin() const;
+    uint8_t const * end() const;
+
+    uint8_t operator[](size_t index) const
+    {
+        return _data[index];
+    }
+
+private:
+
+    std::shared_ptr<void const> _owner;
+    uint8_t const * _data = nullptr;
+    size_t _size = 0;
+};
+#endif /*CARTRIDGEDATA*/
@@ -1,31 +1,92 @@
 #ifndef _CPU_
 #define _CPU_
 
+#include <memory>
+#include <set>
 #include <string>
 #include "memory.hpp"
 #include "iromloader.hpp"
 #include "instructionhandler.hpp"
+#include "interpreter.hpp"
+#include "blockcache.hpp"
+#include "jit.hpp"
 #include "interupthandler.hpp"
 #include "timer.hpp"
 #include "graphics.hpp"
-#include "irenderer.hpp"
+#include "scheduler.hpp"
+#include "idleloop.hpp"
+#include "disassembler.hpp"
+#include "tracesink.hpp"
+#include "profiler.hpp"
+#include "log.hpp"
+#include "iframeobserver.hpp"
 
-//TEMP
-#include <QObject>
+class Cpu
+{
+public:
+    //REFERENCE runs the IInstructions classes and keeps the readable
+    //instruction for the debugger, INTERPRETER is the fast core,
+    //BLOCK_CACHE runs it on pre-decoded blocks, JIT compiles the hot ones
+    enum class CORE
+        {
+            REFERENCE,
+            INTERPRETER,
+            BLOCK_CACHE,
+            JIT
+        };
 
+    //why runCycles or runFrame returned
+    enum class RUN_STATUS
+        {
+            CYCLES_DONE,
+            FRAME_COMPLETE,
+            BREAKPOINT,
+            FAULT,
+            NO_GAME
+        };
 
-class Cpu : public QObject
-{ // TEMP
-    Q_OBJECT
-public:
-    Cpu(IRomLoader& romloader);
+    Cpu(IRomLoader& romloader, CORE core = CORE::REFERENCE);
     int getCurrentCycles();
+    //told by update after each frame, nullptr for none
+    void setFrameObserver(IFrameObserver* observer);
+    //opCodes and cycles run from now on, GB_PROFILE builds only,
+    //nullptr stops. The JIT core only records the blocks it interprets
+    void setProfiler(Profiler* profiler);
+    //JIT core only, false interprets its blocks
+    void setJitEnabled(bool isEnabled);
+    //binary trace of every step, the BLOCK_CACHE and JIT cores only record block entries
+    bool startTrace(std::string const & fileName);
+    void stopTrace();
+    //cycles skipped in polling loops since the game was launched
+    IdleLoopDetector::Stats const & getIdleLoopStats() const;
+    //true once an illegal opCode hung the CPU, getFault tells where
+    bool isLocked() const;
+    IInterruptHandler::Fault const & getFault() const;
     // void boot();
 
+    //loads the game without running it, runCycles and runFrame drive it.
+    //The machine starts over as at power on, whatever ran before.
+    //The battery backed ram is kept in the .sav next to the rom
+    bool loadGame(std::string const & cartridgeName);
+    //runs whole instructions until at least cycles cycles went by,
+    //FRAME_COMPLETE when a frame ended on the way
+    RUN_STATUS runCycles(int cycles);
+    //runs up to the end of the current frame
+    RUN_STATUS runFrame();
+    //both stop before running the instruction at a breakpoint, except the
+    //first one of the call, the BLOCK_CACHE and JIT cores only stop on block entries.
+    //They stop on FAULT right after the instruction that hung the CPU
+    void addBreakpoint(uint16_t pc);
+    void removeBreakpoint(uint16_t pc);
+
     void nextStep();
     void updateDebug();
     bool launchGameDebug(std::string const & cartridgeName);
     IMemory::State getState();
+    //registers and opcode only, for the checks run after every step
+    IMemory::RegisterState getRegisterState();
+    //the whole adress space at once, see Memory::copyMemory
+    void copyMemory(IMemory::RomData& snapshot);
 
     void update();
     bool launchGame(std::string const & cartridgeName);
@@ -37,26 +98,39 @@ public:
         return _graphics.getScreenData();
     }
 
-signals:
-    void screen_refresh();
-
 private:
 
+    //one instruction or block, or the events while halted, plus the idle loop
+    //skipped after it, at most cyclesLeft of them
+    int step(int cyclesLeft);
+    //runs cycles cycles, or up to the end of the frame when isFrame
+    RUN_STATUS run(int cycles, bool isFrame);
+    void loadSaveFile(std::string const & cartridgeName);
+
     bool _gameLoaded = false;
     int _cycles = 0;
     int const _maxCycles = 70221;
     Memory _memory;
     IRomLoader& _romLoader;
-    InterruptHandler _interruptHandler;
-    Timer _timer;
-    InstructionHandler _instructionHandler;
-    Graphics _graphics;
-    // IRenderer _renderer;
-
-    std::stringstream _readableInstructionStream;
-
-    // TEMP
-    quint8 _screenBuffer[144][160][4];
+    //the components are built on the concrete Memory,
+    //the IMemory ones are left to the tests
+    BasicInterruptHandler<Memory> _interruptHandler;
+    BasicTimer<Memory> _timer;
+    std::unique_ptr<IInstructionHandler> _instructionHandler;
+    //same object as _instructionHandler for the BLOCK_CACHE and JIT cores
+    BlockCache* _blockCache = nullptr;
+    Jit* _jit = nullptr;
+    BasicGraphics<Memory> _graphics;
+    //runs the three above when they are due
+    BasicScheduler<Memory> _scheduler;
+    IdleLoopDetector _idleLoop;
 
+    //instruction run by the latest updateDebug, for getReadableInstruction
+    Disassembler::Bytes _debugBytes{};
+    uint8_t _debugFlags = 0;
+    bool _hasDebugInstruction = false;
+    std::unique_ptr<TraceSink> _traceSink;
+    std::set<uint16_t> _breakpoints;
+    IFrameObserver* _frameObserver = nullptr;
 };
 #endif /*CPU*/
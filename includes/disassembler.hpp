@@ -0,0 +1,44 @@
+#ifndef _DISASSEMBLER_
+#define _DISASSEMBLER_
+
+#include <array>
+#include <string>
+#include "imemory.hpp"
+
+//Readable text of an instruction, built on demand from the bytes at PC
+//so the cores never format anything while running. Conditional jumps
+//and calls also need the flags as they were before the instruction.
+class Disassembler
+{
+public:
+
+    using Bytes = std::array<uint8_t, 3>;
+
+    //%n next 8 bits, %w next 16 bits, %e next 8 bits as signed
+    struct Mnemonic
+    {
+        Mnemonic(char const * format = nullptr)
+            :format(format){};
+        //the operand only shows when the flag test passes
+        Mnemonic(char const * format, IMemory::FLAG flag, bool isToBeSet)
+            :format(format),
+             isConditional(true),
+             flag(flag),
+             isToBeSet(isToBeSet){};
+
+        char const * format;
+        bool isConditional = false;
+        IMemory::FLAG flag = IMemory::FLAG::Z;
+        bool isToBeSet = false;
+    };
+
+    static std::string disassemble(Bytes const & bytes, uint8_t flags);
+    static std::string disassemble(IMemory& memory, uint16_t pc);
+    //same text as Cpu's debugger history, "[opCode] instruction"
+    static std::string getHistoryLine(Bytes const & bytes, uint8_t flags);
+
+private:
+
+    static std::array<Mnemonic, 0x100> const & getTable();
+};
+#endif /*DISASSEMBLER*/
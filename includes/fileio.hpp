@@ -9,5 +9,6 @@ public:
     int openFile(std::string const & fileName);
     int readFile(uint8_t *buff, int fd);
     void closeFile(int fd);
+    std::shared_ptr<MappedFile> mapFile(int fd);
 };
 #endif /*FILEIO*/
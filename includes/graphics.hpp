@@ -4,6 +4,7 @@
 #include <bitset>
 #include "imemory.hpp"
 #include "iinterupthandler.hpp"
+#include "iiohandler.hpp"
 
 struct RGB
 {
@@ -17,7 +18,8 @@ public:
     uint8_t _blue;
 };
 
-class Graphics
+template <class MEMORY>
+class BasicGraphics : public IIoHandler
 {
 public:
 
@@ -49,15 +51,28 @@ public:
             BGDISPLAY     = 0
         };
 
-    Graphics(IMemory& memory, IInterruptHandler& interruptHandler);
+    //registered for the scanline and the dma until destroyed
+    BasicGraphics(MEMORY& memory, IInterruptHandler& interruptHandler);
+    ~BasicGraphics();
+    //any write resets the scanline, a write to the dma register copies
+    //the 0xa0 bytes from data << 8 to the oam
+    uint8_t writeIo(uint16_t adress, uint8_t data, uint8_t value) override;
     void update(int cycles);
+    //driven by the scheduler instead of update, cycles is the master clock
+    //at the instruction boundary, returns the next deadline
+    uint64_t tickScanline(uint64_t cycles, int instructionCycles);
     std::vector<std::vector<RGB>> const & getScreenData();
     void resetScreen();
+    //for a new game, with the master clock back at 0
+    void reset();
 
 private:
 
     bool isLCDEnabled();
     void setLCDStatus();
+    std::bitset<8> getLCDStatus(bool& isInterruptRequested);
+    bool isLCDStatusUpToDate();
+    int getCyclesToNextMode();
     void drawScanline();
     void drawCurrentLine();
     void issueVerticalBlank();
@@ -84,15 +99,18 @@ private:
     };
 
     std::vector<std::vector<RGB>> _screenData;
-    IMemory& _memory;
+    MEMORY& _memory;
     IInterruptHandler& _interruptHandler;
 
     int _scanlineCounter = 0;
+    uint64_t _tickCycles = 0;
 
+    uint16_t const _interruptRequest   = 0xff0f;
     uint16_t const _windowX            = 0xff4B;
     uint16_t const _windowY            = 0xff4A;
     uint16_t const _colorPaletteAdress = 0xff47;
     uint16_t const _coincidenceAdress  = 0xff45;
+    uint16_t const _dmaAdress          = 0xff46;
     uint16_t const _scanlineAdress     = 0xff44;
     uint16_t const _scrollX            = 0xff43;
     uint16_t const _scrollY            = 0xff42;
@@ -109,4 +127,6 @@ private:
     uint8_t const  _verticalBlancmaxScanline   = 0x99;
 
 };
+
+using Graphics = BasicGraphics<IMemory>;
 #endif                          /*GRAPHICS*/
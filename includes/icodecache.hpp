@@ -0,0 +1,25 @@
+#ifndef _ICODECACHE_
+#define _ICODECACHE_
+
+#include <array>
+#include <cstdint>
+
+//Told by Memory when a byte that backs cached code is written
+class ICodeCache
+{
+public:
+    virtual ~ICodeCache() = default;
+    virtual void invalidate(uint16_t adress) = 0;
+    virtual void clear() = 0;
+
+    bool isCode(uint16_t adress) const
+    {
+        return _codeMap[adress] != 0;
+    }
+
+protected:
+
+    //number of cached blocks covering each adress
+    std::array<uint8_t, 0x10000> _codeMap{};
+};
+#endif /*ICODECACHE*/
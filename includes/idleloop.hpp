@@ -0,0 +1,58 @@
+#ifndef _IDLELOOP_
+#define _IDLELOOP_
+
+#include <array>
+#include <cstdint>
+#include "memory.hpp"
+#include "scheduler.hpp"
+
+//Skips the loops polling LY, STAT or IF, like ldh a,(44) / cp 90 / jr nz.
+//The loop first loads the register into A, then only tests A and jumps back,
+//so every iteration leaves the same state until an event changes the value.
+//Whole iterations are skipped up to the next deadline, only the instruction
+//boundaries where events are due get visited, and the skip ends as soon as
+//the value changes or an interrupt moves PC.
+class IdleLoopDetector
+{
+public:
+
+    struct Stats
+    {
+        uint64_t skippedCycles = 0;
+        uint64_t skips = 0;
+    };
+
+    IdleLoopDetector(Memory& memory, BasicScheduler<Memory>& scheduler);
+    //called when PC went back to or before lastPc, the latest instruction
+    //or block run, returns the cycles skipped, at most maxCycles
+    int skip(uint16_t lastPc, int maxCycles);
+    Stats const & getStats() const;
+    void resetStats();
+
+    static int const _maxInstructions = 6;
+
+private:
+
+    struct Loop
+    {
+        //the branch back is the last instruction
+        std::array<uint8_t, _maxInstructions> opCodes{};
+        std::array<uint8_t, _maxInstructions> operands{};
+        std::array<int, _maxInstructions> cycles{};
+        std::array<uint16_t, _maxInstructions> nextPcs{};
+        int length = 0;
+        int iterationCycles = 0;
+        bool isPolling = false;
+        uint16_t polledAdress = 0;
+    };
+
+    bool decode(uint16_t start, uint16_t lastPc, Loop& loop);
+    bool isSteady(Loop const & loop);
+    bool isPolled(uint16_t adress) const;
+    void add(Loop& loop, uint16_t pc, int cycles, uint16_t nextPc);
+
+    Memory& _memory;
+    BasicScheduler<Memory>& _scheduler;
+    Stats _stats;
+};
+#endif /*IDLELOOP*/
@@ -1,9 +1,11 @@
 #ifndef _IFILEIO_
 #define _IFILEIO_
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <cstdint>
+#include "mappedfile.hpp"
 
 class IFileIO
 {
@@ -11,5 +13,11 @@ public:
     virtual int openFile(std::string const & fileName) = 0;
     virtual int readFile(uint8_t *buff, int fd) = 0;
     virtual void closeFile(int fd) = 0;
+    //nullptr when the file can not be mapped, it is read instead
+    virtual std::shared_ptr<MappedFile> mapFile(int fd)
+    {
+        (void)fd;
+        return nullptr;
+    }
 };
 #endif /*IFILEIO*/
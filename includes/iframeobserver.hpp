@@ -0,0 +1,16 @@
+#ifndef _IFRAMEOBSERVER_
+#define _IFRAMEOBSERVER_
+
+#include <vector>
+#include "graphics.hpp"
+
+//Told by Cpu::update each time a frame is complete, on the thread
+//running the game, the front ends draw the screen from there
+class IFrameObserver
+{
+public:
+
+    virtual ~IFrameObserver() = default;
+    virtual void frameCompleted(std::vector<std::vector<RGB>> const & screen) = 0;
+};
+#endif /*IFRAMEOBSERVER*/
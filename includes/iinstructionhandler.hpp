@@ -3,16 +3,16 @@
 
 #include "imemory.hpp"
 
+class Profiler;
+
 class IInstructionHandler
 {
 public:
+    virtual ~IInstructionHandler() = default;
+    //an unknown opCode locks the CPU through IInterruptHandler::lockUp
+    //and leaves PC on it
     virtual int doInstruction(uint8_t opCode) = 0;
-
-    std::string getReadableInstruction()
-    {
-        return _latestReadableInstruction;
-    }
-
-    std::string _latestReadableInstruction;
+    //records the instructions run while GB_PROFILE is on, nullptr stops
+    virtual void setProfiler(Profiler*) {}
 };
 #endif /*IINSTRUCTIONHANDLER*/
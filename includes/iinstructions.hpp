@@ -1,40 +1,57 @@
 #ifndef _IINSTRUCTIONS_
 #define _IINSTRUCTIONS_
 
-#include <sstream>
-#include <boost/log/trivial.hpp>
+#include <array>
 #include "imemory.hpp"
 
-class IInstructions
+//MEMORY is IMemory for the mockable build, or the concrete Memory
+//so the accesses of the instructions are resolved at compile time
+template <class MEMORY>
+class BasicInstructions
 {
 public:
-    IInstructions(int cycles)
+    BasicInstructions(int cycles)
         :_cycles(cycles){};
 
-    int doOp(IMemory& memory) {
-        doInstruction(memory);
+    int doOp(MEMORY& memory) {
+        doInstructionImpl(memory);
         return _cycles;
     };
 
+    virtual void doInstructionImpl(MEMORY& memory) = 0;
+
+    int _cycles;
+
+protected:
 
-    std::string getReadableInstruction()
+    //one setFlag or unsetFlag call per flag, as the mocked tests expect
+    static void setFlag(MEMORY& memory, IMemory::FLAG flag, bool isSet)
     {
-        return _readableInstructionStream.str();
+        if (isSet) {
+            memory.setFlag(flag);
+        }
+        else {
+            memory.unsetFlag(flag);
+        }
     }
 
-    void doInstruction(IMemory& memory)
+    //rotations and shifts: Z from the result, N and H cleared,
+    //C from the bit shifted out
+    static uint8_t setShiftFlags(MEMORY& memory, uint8_t result, bool carry)
     {
-        _readableInstructionStream.str({}); // reset
-
-        // _readableInstructionStream <<  "[" << std::hex << 
-        //     static_cast<int>(memory.getCurrentOpCode()) << "] ";
-        doInstructionImpl(memory);
-        BOOST_LOG_TRIVIAL(debug) << _readableInstructionStream.str();
-    };
+        setFlag(memory, IMemory::FLAG::Z, result == 0x00);
+        memory.unsetFlag(IMemory::FLAG::N);
+        memory.unsetFlag(IMemory::FLAG::H);
+        setFlag(memory, IMemory::FLAG::C, carry);
+        return result;
+    }
+};
 
-    virtual void doInstructionImpl(IMemory& memory) = 0;
+//0x000 to 0x0FF == opCode     0x100 to 0x1FF == 0xCB prefixed opCode
+static uint16_t const binaryInstructionsOffset = 0x100;
+template <class MEMORY>
+using BasicDispatchTable = std::array<BasicInstructions<MEMORY>*, 0x200>;
 
-    int _cycles;
-    std::stringstream _readableInstructionStream;
-};
+using IInstructions = BasicInstructions<IMemory>;
+using DispatchTable = BasicDispatchTable<IMemory>;
 #endif /*IINSTRUCTIONS*/
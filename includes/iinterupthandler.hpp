@@ -17,15 +17,62 @@ public:
             JOYPAD = 4
         };
 
+    //what an illegal opCode left, PC stays on it
+    struct Fault
+    {
+        uint16_t pc = 0;
+        uint8_t opCode = 0;
+    };
+
     virtual void doInterrupt() = 0;
     virtual bool isMasterSwitchEnabled() = 0;
     virtual void enableMasterSwitch() = 0;
     virtual void disableMasterSwitch() = 0;
     virtual void requestInterrupt(IInterruptHandler::INTERRUPT id) = 0;
+    //HALT and STOP, no instruction runs until an enabled interrupt is requested
+    virtual void halt()
+    {
+        _isHalted = true;
+    }
+
+    bool isHalted() const
+    {
+        return _isHalted;
+    }
+
+    //illegal opCode, the CPU hangs for good, interrupts included
+    void lockUp(uint16_t pc, uint8_t opCode)
+    {
+        _isLocked = true;
+        _isHalted = true;
+        _fault = {pc, opCode};
+    }
+
+    //a new game starts unlocked, awake and with interrupts disabled
+    void reset()
+    {
+        _masterInterruptSwitch = false;
+        _isHalted = false;
+        _isLocked = false;
+        _fault = Fault();
+    }
+
+    bool isLocked() const
+    {
+        return _isLocked;
+    }
+
+    Fault const & getFault() const
+    {
+        return _fault;
+    }
 
 protected:
 
     bool _masterInterruptSwitch = false;
+    bool _isHalted = false;
+    bool _isLocked = false;
+    Fault _fault;
     uint16_t const _interruptEnableRegister = 0xffff;
     uint16_t const _interruptRequestRegister = 0xff0f;
 
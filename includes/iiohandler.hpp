@@ -0,0 +1,22 @@
+#ifndef _IIOHANDLER_
+#define _IIOHANDLER_
+
+#include <cstdint>
+
+//Registered with IMemory::setIoHandler for the io registers with side
+//effects, from 0xff00 to 0xff7f, the others are plain bytes
+class IIoHandler
+{
+public:
+
+    virtual ~IIoHandler() = default;
+    //value is the byte held at adress, returns the byte read
+    virtual uint8_t readIo(uint16_t adress, uint8_t value)
+    {
+        (void)adress;
+        return value;
+    }
+    //value is the byte held at adress, returns the byte to hold
+    virtual uint8_t writeIo(uint16_t adress, uint8_t data, uint8_t value) = 0;
+};
+#endif /*IIOHANDLER*/
@@ -3,18 +3,42 @@
 
 #include <array>
 #include <map>
+#include <string>
 #include <vector>
 #include "registers.hpp"
+#include "cartridgedata.hpp"
+#include "iiohandler.hpp"
+
+class IMemory;
+
+//the 64KB as the cpu sees them, with the banks mapped in. Nothing is
+//copied, every byte is read through the memory when asked for, so the
+//view follows the writes and is only valid while the memory lives
+class MemoryView
+{
+public:
+    MemoryView() = default;
+    explicit MemoryView(IMemory& memory);
+
+    uint8_t operator[](size_t adress) const;
+    size_t size() const;
+    bool operator==(MemoryView const & other) const;
+    bool operator!=(MemoryView const & other) const;
+
+private:
+    IMemory* _memory = nullptr;
+};
 
 class IMemory
 {
 public:
-    static size_t const cartridgeSize =  0x200000;
+    //the largest mbc5 rom
+    static size_t const maxCartridgeSize =  0x800000;
     static size_t const romSize =  0x10000;
     static size_t const bank0Size =  0x4000;
     static size_t const readOnlyBankSize =  0x8000;
 
-    using CartridgeData = std::array<uint8_t, cartridgeSize>;
+    using CartridgeData = ::CartridgeData;
     using RomData = std::array<uint8_t, romSize>;
 
     struct State
@@ -23,7 +47,16 @@ public:
         uint16_t pcValue;
         std::vector<std::pair<std::string, uint16_t>> reg16Bit;
         std::vector<std::pair<std::string, bool>> flags;
-        RomData readOnlyMemory;
+        MemoryView readOnlyMemory;
+    };
+    //what getState gives without the strings and the memory, cheap
+    //enough to ask for after every instruction
+    struct RegisterState
+    {
+        Registers registers;
+        uint8_t opCode;
+        uint8_t interruptEnable;
+        uint8_t interruptRequest;
     };
     enum class REG8BIT
         {
@@ -51,16 +84,98 @@ public:
             C = 4
         };
 
+    enum class ALU_OPERATION
+        {
+            ADD, ADC,
+            SUB, SBC,
+            INC, DEC
+        };
+
+    //flags of an 8 bit alu operation, CP is a SUB and INC/DEC keep C
+    static uint8_t getAluFlagsMask(ALU_OPERATION operation)
+    {
+        if (operation == ALU_OPERATION::INC || operation == ALU_OPERATION::DEC) {
+            return 0xE0;
+        }
+        return 0xF0;
+    }
+
+    static uint8_t computeAluFlags(ALU_OPERATION operation, uint8_t value, uint8_t operand, bool carry)
+    {
+        uint8_t carryValue = carry ? 0x01 : 0x00;
+        int result = 0;
+        bool isSub = false;
+        bool halfCarry = false;
+        bool fullCarry = false;
+        switch (operation) {
+        case ALU_OPERATION::ADD:
+            carryValue = 0x00;
+            //fallthrough
+        case ALU_OPERATION::ADC:
+            result = value + operand + carryValue;
+            halfCarry = (((value & 0x0F) + (operand & 0x0F) + carryValue) & 0x10) == 0x10;
+            fullCarry = result > 0xff;
+            break;
+        case ALU_OPERATION::SUB:
+            carryValue = 0x00;
+            //fallthrough
+        case ALU_OPERATION::SBC: {
+            uint8_t resultWithoutCarryOff = value - operand;
+            result = resultWithoutCarryOff - carryValue;
+            isSub = true;
+            halfCarry = (value & 0x0F) < (operand & 0x0F)
+                || (resultWithoutCarryOff & 0x0F) < carryValue;
+            fullCarry = value < operand || resultWithoutCarryOff < carryValue;
+            break;
+        }
+        case ALU_OPERATION::INC:
+            result = value + 1;
+            halfCarry = (((value & 0x0F) + 0x01) & 0x10) == 0x10;
+            break;
+        case ALU_OPERATION::DEC:
+            result = value - 1;
+            isSub = true;
+            halfCarry = (value & 0x0F) == 0x00;
+            break;
+        }
+        return (static_cast<uint8_t>(result) == 0x00) << static_cast<int>(FLAG::Z)
+            | isSub << static_cast<int>(FLAG::N)
+            | halfCarry << static_cast<int>(FLAG::H)
+            | fullCarry << static_cast<int>(FLAG::C);
+    }
+
     uint8_t getCurrentOpCode() {
        return readInMemory(get16BitRegister(REG16BIT::PC));
     }
-    virtual void incrementDividerRegister() = 0;
+    //the accesses to adress go through handler, nullptr to unregister
+    virtual void setIoHandler(uint16_t adress, IIoHandler* handler)
+    {
+        (void)adress;
+        (void)handler;
+    }
     virtual void incrementScanline() = 0;
 
-    virtual CartridgeData const getCartridge() = 0;
-    virtual RomData const getReadOnlyMemory() = 0;
+    virtual CartridgeData const & getCartridge() = 0;
+    MemoryView getReadOnlyMemory()
+    {
+        return MemoryView(*this);
+    }
     virtual bool setCartridge(CartridgeData const & cartridge) = 0;
     virtual State getState() = 0;
+    virtual RegisterState getRegisterState()
+    {
+        RegisterState state;
+        state.registers.af = get16BitRegister(REG16BIT::AF);
+        state.registers.bc = get16BitRegister(REG16BIT::BC);
+        state.registers.de = get16BitRegister(REG16BIT::DE);
+        state.registers.hl = get16BitRegister(REG16BIT::HL);
+        state.registers.sp = get16BitRegister(REG16BIT::SP);
+        state.registers.pc = get16BitRegister(REG16BIT::PC);
+        state.opCode = readInMemory(state.registers.pc);
+        state.interruptEnable = readInMemory(0xffff);
+        state.interruptRequest = readInMemory(0xff0f);
+        return state;
+    }
     virtual bool writeInMemory(uint8_t data, uint16_t adress) = 0;
     virtual uint8_t readInMemory(uint16_t adress) = 0;
     virtual void set8BitRegister(REG8BIT reg,uint8_t value) = 0;
@@ -73,6 +188,25 @@ public:
     virtual void setBitInRegister(int bit, REG8BIT reg) = 0;
     virtual void unsetBitInRegister(int bit, REG8BIT reg) = 0;
     virtual bool isSet(int bit, REG8BIT reg) = 0;
+
+    //Memory can defer these until F is read
+    virtual void setAluFlags(ALU_OPERATION operation, uint8_t value, uint8_t operand, bool carry = false)
+    {
+        uint8_t flags = computeAluFlags(operation, value, operand, carry);
+        uint8_t mask = getAluFlagsMask(operation);
+        for (FLAG flag : {FLAG::Z, FLAG::N, FLAG::H, FLAG::C}) {
+            uint8_t bit = 1 << static_cast<int>(flag);
+            if (!(mask & bit)) {
+                continue;
+            }
+            if (flags & bit) {
+                setFlag(flag);
+            }
+            else {
+                unsetFlag(flag);
+            }
+        }
+    }
 };
 
 static std::map<IMemory::FLAG, std::string> debugflag = {
@@ -81,6 +215,37 @@ static std::map<IMemory::FLAG, std::string> debugflag = {
     {IMemory::FLAG::H, "H"},
     {IMemory::FLAG::C, "C"}
 };
+inline MemoryView::MemoryView(IMemory& memory)
+    :_memory(&memory){}
+
+inline uint8_t MemoryView::operator[](size_t adress) const
+{
+    return _memory->readInMemory(static_cast<uint16_t>(adress));
+}
+
+inline size_t MemoryView::size() const
+{
+    return _memory != nullptr ? IMemory::romSize : 0;
+}
+
+inline bool MemoryView::operator==(MemoryView const & other) const
+{
+    if (size() != other.size()) {
+        return false;
+    }
+    for (size_t adress = 0; adress < size(); adress++) {
+        if ((*this)[adress] != other[adress]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool MemoryView::operator!=(MemoryView const & other) const
+{
+    return !(*this == other);
+}
+
 static std::map<IMemory::REG8BIT, std::string>  debugReg8Bit = {
     {IMemory::REG8BIT::A, "A"},
     {IMemory::REG8BIT::F, "F"},
@@ -2,7 +2,6 @@
 #define _INSTRUCTIONS_
 
 #include <iostream>
-#include <bitset>
 #include <map>
 #include <string>
 #include <boost/log/trivial.hpp>
@@ -17,61 +16,55 @@
 //AR  == Adress in 0xff00 + R       AN == Adress in 0xff00 + N
 
 //OpCode 0x00
-class NOP : public IInstructions
+template <class MEMORY>
+class NOP : public BasicInstructions<MEMORY>
 {
 public :
     NOP(int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "nop";
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
     }
 };
 
 //OpCode 0x06 0x0E 0x16 0x1E 0x26 0x2E 0x3E
-class LD_R_N : public IInstructions
+template <class MEMORY>
+class LD_R_N : public BasicInstructions<MEMORY>
 {
 public:
     LD_R_N(int cycles, IMemory::REG8BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _register(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint16_t valueToLoad = memory.readInMemory(cursor + 1);
         memory.set8BitRegister(_register, valueToLoad);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
-        _readableInstructionStream
-            << "ld " << debugReg8Bit[_register] << ","
-            << std::hex << static_cast<int>(valueToLoad);
     }
 
     IMemory::REG8BIT _register;
 };
 
 //opCode 0x0A 0x1A 0x2A 0x3A 0x46 0x4E 0x56 ox5E 0x66 0x6E 0x7E
-class LD_R_ARR : public IInstructions
+template <class MEMORY>
+class LD_R_ARR : public BasicInstructions<MEMORY>
 {
 public:
     LD_R_ARR(int cycles, IMemory::REG8BIT reg8Bit, IMemory::REG16BIT reg16Bit, int addTo16BitReg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit),
          _8BitReg(reg8Bit),
          _addTo16BitReg(addTo16BitReg){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(_16BitReg);
         uint8_t valueToLoad = memory.readInMemory(adress);
         memory.set8BitRegister(_8BitReg, valueToLoad);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << "ld " << debugReg8Bit[_8BitReg]
-            << ",(" << debugReg16Bit[_16BitReg]
-            <<  (_addTo16BitReg == 0 ? "" : _addTo16BitReg > 0 ? "+" : "-")
-            << ")";
         if (_addTo16BitReg != 0) {
             adress += _addTo16BitReg;
             memory.set16BitRegister(_16BitReg, adress);
@@ -84,25 +77,22 @@ public:
 };
 
 //OpCode 0x02 0x12 0x22 0x32 0x70 0x71 0x72 0x73 0x74 0x75 0x77
-class LD_ARR_R : public IInstructions
+template <class MEMORY>
+class LD_ARR_R : public BasicInstructions<MEMORY>
 {
 public:
    LD_ARR_R(int cycles, IMemory::REG16BIT reg16Bit, IMemory::REG8BIT reg8Bit, int addTo16BitReg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit),
          _8BitReg(reg8Bit),
          _addTo16BitReg(addTo16BitReg){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t reg8BitValue = memory.get8BitRegister(_8BitReg);
         uint16_t reg16BitValue = memory.get16BitRegister(_16BitReg);
         memory.writeInMemory(reg8BitValue, reg16BitValue);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << "ld (" << debugReg16Bit[_16BitReg]
-            <<  (_addTo16BitReg == 0 ? "" : _addTo16BitReg > 0 ? "+" : "-")
-            << ")," << debugReg8Bit[_8BitReg];
 
         if (_addTo16BitReg != 0) {
             reg16BitValue += _addTo16BitReg;
@@ -116,22 +106,20 @@ public:
 };
 
 //OpCode 0x40 to 0x45 0x47 to 0x4D 0x4F 0x50 to 0x55 0x57 to 0x5D 0x5F 0x60 to 0x65 0x67 to 0x6D 0x6F 0x78 to 0x7D 0x7F
-class LD_R_R : public IInstructions
+template <class MEMORY>
+class LD_R_R : public BasicInstructions<MEMORY>
 {
 public:
     LD_R_R(int cycles, IMemory::REG8BIT toCopyTo, IMemory::REG8BIT toCopyFrom)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _toCopyTo(toCopyTo),
          _toCopyFrom(toCopyFrom){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t valueToCopy = memory.get8BitRegister(_toCopyFrom);
         memory.set8BitRegister(_toCopyTo, valueToCopy);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << "ld " << debugReg8Bit[_toCopyTo]
-            << ", " << debugReg8Bit[_toCopyFrom];
     }
 
     IMemory::REG8BIT _toCopyTo;
@@ -139,36 +127,35 @@ public:
 };
 
 //OpCode 0x36
-class LD_ARR_N : public IInstructions
+template <class MEMORY>
+class LD_ARR_N : public BasicInstructions<MEMORY>
 {
 public:
     LD_ARR_N (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint16_t adress = memory.get16BitRegister(_16BitReg);
         uint8_t valueToLoad = memory.readInMemory(cursor + 1);
         memory.writeInMemory(valueToLoad, adress);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
-        _readableInstructionStream
-            << "ld (" << debugReg16Bit[_16BitReg]
-            << "), " << std::hex << static_cast<int>(valueToLoad);
     }
 
     IMemory::REG16BIT _16BitReg;
 };
 
 //OpCode 0x08
-class LD_ANN_RR : public IInstructions
+template <class MEMORY>
+class LD_ANN_RR : public BasicInstructions<MEMORY>
 {
 public:
     LD_ANN_RR (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t MS = memory.readInMemory(cursor + 2);
         uint8_t LS = memory.readInMemory(cursor + 1);
@@ -180,31 +167,26 @@ public:
         memory.writeInMemory(lessSignificantBit, adress);
         memory.writeInMemory(mostSignificantBit, adress + 1);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 3);
-        _readableInstructionStream
-            << "ld $" << std::hex << static_cast<int>(adress)
-            << ", " << debugReg16Bit[_16BitReg];
     }
 
     IMemory::REG16BIT _16BitReg;
 };
 
 //OpCode 0xF9
-class LD_RR_RR : public IInstructions
+template <class MEMORY>
+class LD_RR_RR : public BasicInstructions<MEMORY>
 {
 public:
     LD_RR_RR (int cycles, IMemory::REG16BIT reg16Bit, IMemory::REG16BIT reg16BitToCopy)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit),
          _16BitRegToCopy(reg16BitToCopy){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t valueToLoad = memory.get16BitRegister(IMemory::REG16BIT::HL);
         memory.set16BitRegister(_16BitReg, valueToLoad);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << "ld " << debugReg16Bit[_16BitReg]
-            << "," << debugReg16Bit[_16BitRegToCopy];
     }
 
     IMemory::REG16BIT _16BitReg;
@@ -212,14 +194,15 @@ public:
 };
 
 //OpCode 0xEA
-class LD_ANN_R : public IInstructions
+template <class MEMORY>
+class LD_ANN_R : public BasicInstructions<MEMORY>
 {
 public:
     LD_ANN_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t reg8BitValue = memory.get8BitRegister(_8BitReg);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t MS = memory.readInMemory(cursor + 2);
@@ -228,22 +211,20 @@ public:
         memory.writeInMemory(reg8BitValue, adress);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 3);
 
-        _readableInstructionStream
-            << "ld $" << std::hex << static_cast<int>(adress)
-            << ","<< debugReg8Bit[_8BitReg];
     }
     IMemory::REG8BIT _8BitReg;
 };
 
 //OpCode 0xFA
-class LD_R_ANN : public IInstructions
+template <class MEMORY>
+class LD_R_ANN : public BasicInstructions<MEMORY>
 {
 public:
     LD_R_ANN (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t MS = memory.readInMemory(cursor + 2);
         uint8_t LS = memory.readInMemory(cursor + 1);
@@ -252,22 +233,20 @@ public:
         memory.set8BitRegister(_8BitReg, value);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 3);
 
-        _readableInstructionStream
-            << "ld " << debugReg8Bit[_8BitReg]
-            << ",$" << std::hex << static_cast<int>(adress);
     }
     IMemory::REG8BIT _8BitReg;
 };
 
 //OpCode 0xE0
-class LDH_AN_R : public IInstructions
+template <class MEMORY>
+class LDH_AN_R : public BasicInstructions<MEMORY>
 {
 public:
     LDH_AN_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t valueToLoad = memory.get8BitRegister(_8BitReg);
         uint8_t next8Bit = memory.readInMemory(cursor + 1);
@@ -275,57 +254,49 @@ public:
         memory.writeInMemory(valueToLoad, adress);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
 
-        _readableInstructionStream
-            << "ldh (" << std::hex << static_cast<int>(next8Bit)
-            << ")," << debugReg8Bit[_8BitReg];
     }
 
     IMemory::REG8BIT _8BitReg;
 };
 
 //OpCode 0xF0
-class LDH_R_AN : public IInstructions
+template <class MEMORY>
+class LDH_R_AN : public BasicInstructions<MEMORY>
 {
 public:
     LDH_R_AN (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t next8Bit = memory.readInMemory(cursor + 1);
         uint16_t adress = 0xff00 + next8Bit;
         uint8_t valueToLoad = memory.readInMemory(adress);
         memory.set8BitRegister(_8BitReg, valueToLoad);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
-        _readableInstructionStream
-            << "ldh " << debugReg8Bit[_8BitReg]
-            << ",(" << std::hex
-            << static_cast<int>(next8Bit) << ")";
     }
 
     IMemory::REG8BIT _8BitReg;
 };
 
 //OpCode 0xE2
-class LDH_AR_R : public IInstructions
+template <class MEMORY>
+class LDH_AR_R : public BasicInstructions<MEMORY>
 {
 public:
     LDH_AR_R (int cycles, IMemory::REG8BIT reg8Bit, IMemory::REG8BIT reg8BitToLoad)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitRegToLoad(reg8BitToLoad),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t valueForAdress = memory.get8BitRegister(_8BitReg);
         uint8_t valueToLoad = memory.get8BitRegister(_8BitRegToLoad);
         uint16_t adress = 0xff00 + valueForAdress;
         memory.writeInMemory(valueToLoad, adress);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << "ldh (" << debugReg8Bit[_8BitReg]
-            << ")," << debugReg8Bit[_8BitRegToLoad];
     }
 
     IMemory::REG8BIT _8BitRegToLoad;
@@ -333,24 +304,22 @@ public:
 };
 
 //OpCode 0xF2
-class LDH_R_AR : public IInstructions
+template <class MEMORY>
+class LDH_R_AR : public BasicInstructions<MEMORY>
 {
 public:
     LDH_R_AR (int cycles, IMemory::REG8BIT reg8BitToLoad, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitRegToLoad(reg8BitToLoad),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t valueForAdress = memory.get8BitRegister(_8BitReg);
         uint16_t adress = 0xff00 + valueForAdress;
         uint8_t valueToLoad = memory.readInMemory(adress);
         memory.set8BitRegister(_8BitRegToLoad, valueToLoad);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << "ldh " << debugReg8Bit[_8BitRegToLoad]
-            << ",(" << debugReg8Bit[_8BitReg] << ")";
     }
 
     IMemory::REG8BIT _8BitRegToLoad;
@@ -358,156 +327,101 @@ public:
 };
 
 //OpCode 0x01 0x11 0x21 0x31
-class LD_RR_NN : public IInstructions
+template <class MEMORY>
+class LD_RR_NN : public BasicInstructions<MEMORY>
 {
 public:
     LD_RR_NN(int cycles, IMemory::REG16BIT reg)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _register(reg){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t MS = memory.readInMemory(cursor + 2);
         uint8_t LS = memory.readInMemory(cursor + 1);
         uint16_t valueToLoad = (static_cast<uint16_t> (MS) << 8) | LS;
         memory.set16BitRegister(_register, valueToLoad);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 3);
-        _readableInstructionStream 
-            << "ld " << debugReg16Bit[_register]
-            << "," << std::hex
-            << static_cast<int>(valueToLoad);
     }
 
     IMemory::REG16BIT _register;
 };
 
 // 0xF8
-class LDHL_SP_N : public IInstructions
+template <class MEMORY>
+class LDHL_SP_N : public BasicInstructions<MEMORY>
 {
 public:
     LDHL_SP_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t regValue = memory.get16BitRegister(IMemory::REG16BIT::SP);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
-        int8_t valueToAdd = static_cast<int8_t>(memory.readInMemory(cursor + 1));
+        uint8_t valueToAdd = memory.readInMemory(cursor + 1);
 
+        //signed offset, the carries are out of the low byte
         memory.unsetFlag(IMemory::FLAG::Z);
         memory.unsetFlag(IMemory::FLAG::N);
-        if ((((regValue & 0x0F00) + (valueToAdd & 0x0F00)) & 0x1000) == 0x1000) {
+        if ((regValue & 0x0F) + (valueToAdd & 0x0F) > 0x0F) {
             memory.setFlag(IMemory::FLAG::H);
         }
         else {
             memory.unsetFlag(IMemory::FLAG::H);
         }
-        if (((static_cast<uint32_t>(regValue) + static_cast<uint32_t>(valueToAdd)) > 0xffff)) {
+        if ((regValue & 0xFF) + valueToAdd > 0xFF) {
             memory.setFlag(IMemory::FLAG::C);
         }
         else {
             memory.unsetFlag(IMemory::FLAG::C);
         }
 
-        memory.set16BitRegister(IMemory::REG16BIT::HL, regValue + valueToAdd);
+        memory.set16BitRegister(IMemory::REG16BIT::HL, regValue + static_cast<int8_t>(valueToAdd));
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
-        _readableInstructionStream
-            << "ld hl, sp + " << std::hex
-            << static_cast<int>(valueToAdd);
     }
 };
 
 //OpCode increment 0x04 0x05 0x0C 0x14 0x15 0x1C 0x1D 0x24 0x25 0x2C 0x2D 0x3C 0x3D
-class INC_DEC_R : public IInstructions
+template <class MEMORY>
+class INC_DEC_R : public BasicInstructions<MEMORY>
 {
 public:
     INC_DEC_R(int cycles, IMemory::REG8BIT reg8Bit, int value)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg8Bit(reg8Bit),
          _value(value){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regValue = memory.get8BitRegister(_reg8Bit);
         uint8_t newValue = regValue + _value;
         memory.set8BitRegister(_reg8Bit, newValue);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << (_value == -1 ? "dec ":"inc ")
-            << debugReg8Bit[_reg8Bit];
 
-        if (newValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if (_value < 0) {
-            memory.setFlag(IMemory::FLAG::N);
-            if ((((regValue & 0x0F) - (0x01 & 0x0F)) & 0x10) == 0x10) {
-                memory.setFlag(IMemory::FLAG::H);
-            }
-            else {
-                memory.unsetFlag(IMemory::FLAG::H);
-            }
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::N);
-            if ((((regValue & 0x0F) + (0x01 & 0x0F)) & 0x10) == 0x10) {
-                memory.setFlag(IMemory::FLAG::H);
-            }
-            else {
-                memory.unsetFlag(IMemory::FLAG::H);
-            }
-        }
+        memory.setAluFlags(_value < 0 ? IMemory::ALU_OPERATION::DEC : IMemory::ALU_OPERATION::INC,
+                           regValue, 0x01);
     }
 
     IMemory::REG8BIT _reg8Bit;
     int _value;
 };
 
-//OpCode inc/dec 0x03 0x0B 0x13 0x1B 0x23 0x2B 0x33 0x3B
-class INC_DEC_RR : public IInstructions
+//OpCode inc/dec 0x03 0x0B 0x13 0x1B 0x23 0x2B 0x33 0x3B, the flags are kept
+template <class MEMORY>
+class INC_DEC_RR : public BasicInstructions<MEMORY>
 {
 public:
     INC_DEC_RR(int cycles, IMemory::REG16BIT reg16Bit, int value)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg16Bit(reg16Bit),
          _value(value){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t regValue = memory.get16BitRegister(_reg16Bit);
         uint16_t newValue = regValue + _value;
         memory.set16BitRegister(_reg16Bit, newValue);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << (_value == -1 ? "dec ":"inc ")
-            << debugReg16Bit[_reg16Bit];
-
-        if (newValue == 0x0000) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if (_value < 0) {
-            memory.setFlag(IMemory::FLAG::N);
-            if ((((regValue & 0x0F00) + (0x0001 & 0x0F00)) & 0x1000) == 0x1000) {
-                memory.setFlag(IMemory::FLAG::H);
-            }
-            else {
-                memory.unsetFlag(IMemory::FLAG::H);
-            }
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::N);
-            if ((((regValue & 0x0F00) + (0x0001 & 0x0F00)) & 0x1000) == 0x1000) {
-                memory.setFlag(IMemory::FLAG::H);
-            }
-            else {
-                memory.unsetFlag(IMemory::FLAG::H);
-            }
-        }
     }
 
     IMemory::REG16BIT _reg16Bit;
@@ -515,15 +429,16 @@ public:
 };
 
 //OpCode inc/dec 0x34 0x35
-class INC_DEC_ARR : public IInstructions
+template <class MEMORY>
+class INC_DEC_ARR : public BasicInstructions<MEMORY>
 {
 public:
    INC_DEC_ARR(int cycles, IMemory::REG16BIT reg16Bit, int value)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _reg16Bit(reg16Bit),
          _value(value){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t adress = memory.get16BitRegister(_reg16Bit);
         uint8_t valueToIncrement = memory.readInMemory(adress);
         uint8_t newValue = valueToIncrement + _value;
@@ -531,34 +446,9 @@ public:
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
-        _readableInstructionStream
-            << (_value == -1 ? "dec (":"inc (")
-            << debugReg16Bit[_reg16Bit] << ")";
 
-        if (newValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if (_value < 0) {
-            memory.setFlag(IMemory::FLAG::N);
-            if ((((valueToIncrement & 0x0F) - (0x01 & 0x0F)) & 0x10) == 0x10) {
-                memory.setFlag(IMemory::FLAG::H);
-            }
-            else {
-                memory.unsetFlag(IMemory::FLAG::H);
-            }
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::N);
-            if ((((valueToIncrement & 0x0F) + (0x01 & 0x0F)) & 0x10) == 0x10) {
-                memory.setFlag(IMemory::FLAG::H);
-            }
-            else {
-                memory.unsetFlag(IMemory::FLAG::H);
-            }
-        }
+        memory.setAluFlags(_value < 0 ? IMemory::ALU_OPERATION::DEC : IMemory::ALU_OPERATION::INC,
+                           valueToIncrement, 0x01);
     }
 
     IMemory::REG16BIT _reg16Bit;
@@ -566,22 +456,21 @@ public:
 };
 
 //OpCode 0xA8 0xA9 0xAA 0xAB 0xAC 0xAD 0xAF
-class XOR_R : public IInstructions
+template <class MEMORY>
+class XOR_R : public BasicInstructions<MEMORY>
 {
 public:
     XOR_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t reg8BitValue = memory.get8BitRegister(_8BitReg);
         uint8_t result = AValue ^ reg8BitValue;
         memory.set8BitRegister(IMemory::REG8BIT::A,result);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
-        _readableInstructionStream
-            << "xor " << debugReg8Bit[_8BitReg];
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -597,14 +486,15 @@ public:
 };
 
 //OpCode 0xB0 0xB1 0xB2 0xB3 0xB4 0xB5 0xB7
-class OR_R : public IInstructions
+template <class MEMORY>
+class OR_R : public BasicInstructions<MEMORY>
 {
 public:
     OR_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t reg8BitValue = memory.get8BitRegister(_8BitReg);
         uint8_t result = AValue | reg8BitValue;
@@ -612,8 +502,6 @@ public:
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
-        _readableInstructionStream
-            << "or " << debugReg8Bit[_8BitReg];
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -629,14 +517,15 @@ public:
 };
 
 //OpCode 0xA0 0xA1 0xA2 0xA3 0xA4 0xA5 0xA7
-class AND_R : public IInstructions
+template <class MEMORY>
+class AND_R : public BasicInstructions<MEMORY>
 {
 public:
     AND_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t reg8BitValue = memory.get8BitRegister(_8BitReg);
         uint8_t result = AValue & reg8BitValue;
@@ -644,8 +533,6 @@ public:
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
-        _readableInstructionStream
-            << "and " << debugReg8Bit[_8BitReg];
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -661,14 +548,15 @@ public:
 };
 
 //opCode 0xAE
-class XOR_ARR : public IInstructions
+template <class MEMORY>
+class XOR_ARR : public BasicInstructions<MEMORY>
 {
 public:
     XOR_ARR (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(_16BitReg);
         uint8_t reg8BitValue = memory.readInMemory(adress);
@@ -677,8 +565,6 @@ public:
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
-        _readableInstructionStream
-            << "xor (" << debugReg16Bit[_16BitReg] << ")";
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -694,14 +580,15 @@ public:
 };
 
 //opCode 0xB6
-class OR_ARR : public IInstructions
+template <class MEMORY>
+class OR_ARR : public BasicInstructions<MEMORY>
 {
 public:
     OR_ARR (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(_16BitReg);
         uint8_t reg8BitValue = memory.readInMemory(adress);
@@ -710,8 +597,6 @@ public:
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
-        _readableInstructionStream
-            << "or (" << debugReg16Bit[_16BitReg] << ")";
 
 
         if (result == 0x00) {
@@ -728,14 +613,15 @@ public:
 };
 
 //opCode 0xA6
-class AND_ARR : public IInstructions
+template <class MEMORY>
+class AND_ARR : public BasicInstructions<MEMORY>
 {
 public:
     AND_ARR (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(_16BitReg);
         uint8_t reg8BitValue = memory.readInMemory(adress);
@@ -745,8 +631,6 @@ public:
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
 
-        _readableInstructionStream
-            << "and (" << debugReg16Bit[_16BitReg] << ")";
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -762,13 +646,14 @@ public:
 };
 
 //opCode 0xEE
-class XOR_N : public IInstructions
+template <class MEMORY>
+class XOR_N : public BasicInstructions<MEMORY>
 {
 public:
     XOR_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t reg8BitValue = memory.readInMemory(cursor + 1);
@@ -777,9 +662,6 @@ public:
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
 
 
-        _readableInstructionStream
-            << "xor $" << std::hex
-            << static_cast<int>(reg8BitValue);
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -795,13 +677,14 @@ public:
 };
 
 //opCode 0xF6
-class OR_N : public IInstructions
+template <class MEMORY>
+class OR_N : public BasicInstructions<MEMORY>
 {
 public:
     OR_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t reg8BitValue = memory.readInMemory(cursor + 1);
@@ -810,9 +693,6 @@ public:
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
 
 
-        _readableInstructionStream
-            << "or $" << std::hex
-            << static_cast<int>(reg8BitValue);
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -828,13 +708,14 @@ public:
 };
 
 //opCode 0xE6
-class AND_N : public IInstructions
+template <class MEMORY>
+class AND_N : public BasicInstructions<MEMORY>
 {
 public:
     AND_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t AValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t reg8BitValue = memory.readInMemory(cursor + 1);
@@ -843,9 +724,6 @@ public:
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
 
 
-        _readableInstructionStream
-            << "and $" << std::hex
-            << static_cast<int>(reg8BitValue);
 
         if (result == 0x00) {
             memory.setFlag(IMemory::FLAG::Z);
@@ -861,39 +739,43 @@ public:
 };
 
 //opCode 0xC1 0xD1 0xE1 0xF1
-class POP_RR : public IInstructions
+template <class MEMORY>
+class POP_RR : public BasicInstructions<MEMORY>
 {
 public:
     POP_RR (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
         uint8_t(mostSignificantBit) = memory.readInMemory(stackPointer + 1);
         uint8_t lessSignificantBit = memory.readInMemory(stackPointer);
         uint16_t valueToLoad = (static_cast<uint16_t> (mostSignificantBit) << 8) | lessSignificantBit;
+        //the low nibble of F always reads 0
+        if (_16BitReg == IMemory::REG16BIT::AF) {
+            valueToLoad &= 0xfff0;
+        }
         memory.set16BitRegister(_16BitReg, valueToLoad);
         memory.set16BitRegister(IMemory::REG16BIT::SP, stackPointer + 2);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
-        _readableInstructionStream
-            << "pop " << debugReg16Bit[_16BitReg];
 
     }
     IMemory::REG16BIT _16BitReg;
 };
 
 //opCode 0xC5 0xD5 0xE5 0xF5
-class PUSH_RR : public IInstructions
+template <class MEMORY>
+class PUSH_RR : public BasicInstructions<MEMORY>
 {
 public:
     PUSH_RR (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
         uint16_t valueToLoad = memory.get16BitRegister(_16BitReg);
 
@@ -906,48 +788,28 @@ public:
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
 
-        _readableInstructionStream << "push " << debugReg16Bit[_16BitReg];
 
     }
     IMemory::REG16BIT _16BitReg;
 };
 
 // 0x80 0x81 0x82 0x83 0x84 0x85 0x87
-class ADD_R : public IInstructions
+template <class MEMORY>
+class ADD_R : public BasicInstructions<MEMORY>
 {
 public:
     ADD_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t valueToAdd = memory.get8BitRegister(_8BitReg);
 
 
-        _readableInstructionStream
-            << "add a," << debugReg8Bit[_8BitReg];
 
         uint8_t result = regAValue + valueToAdd;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((((regAValue & 0x0F) + (valueToAdd & 0x0F)) & 0x10) == 0x10) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (((static_cast<uint16_t>(regAValue) + static_cast<uint16_t>(valueToAdd)) > 0x00ff)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.unsetFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::ADD, regAValue, valueToAdd);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -957,41 +819,22 @@ public:
 };
 
 // 0x86
-class ADD_ARR : public IInstructions
+template <class MEMORY>
+class ADD_ARR : public BasicInstructions<MEMORY>
 {
 public:
     ADD_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t valueToAdd = memory.readInMemory(adress);
 
 
-        _readableInstructionStream
-            << "add a,(hl)";
 
         uint8_t result = regAValue + valueToAdd;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((((regAValue & 0x0F) + (valueToAdd & 0x0F)) & 0x10) == 0x10) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (((static_cast<uint16_t>(regAValue) + static_cast<uint16_t>(valueToAdd)) > 0x00ff)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.unsetFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::ADD, regAValue, valueToAdd);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -1001,23 +844,22 @@ public:
 };
 
 // 0x09 0x19 0x29 0x39
-class ADD_RR : public IInstructions
+template <class MEMORY>
+class ADD_RR : public BasicInstructions<MEMORY>
 {
 public:
     ADD_RR (int cycles, IMemory::REG16BIT reg16Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _16BitReg(reg16Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t regAValue = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint16_t valueToAdd = memory.get16BitRegister(_16BitReg);
 
 
-        _readableInstructionStream
-            << "add hl," << debugReg16Bit[_16BitReg];
 
         uint16_t result = regAValue + valueToAdd;
-        if ((((regAValue & 0x0F00) + (valueToAdd & 0x0F00)) & 0x1000) == 0x1000) {
+        if ((regAValue & 0x0FFF) + (valueToAdd & 0x0FFF) > 0x0FFF) {
             memory.setFlag(IMemory::FLAG::H);
         }
         else {
@@ -1039,42 +881,22 @@ public:
 };
 
 // 0xC6
-class ADD_N : public IInstructions
+template <class MEMORY>
+class ADD_N : public BasicInstructions<MEMORY>
 {
 public:
     ADD_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t valueToAdd = memory.readInMemory(cursor + 1);
 
 
-        _readableInstructionStream
-            << "add a,$" << std::hex
-            << static_cast<int>(valueToAdd);
 
         uint8_t result = regAValue + valueToAdd;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((((regAValue & 0x0F) + (valueToAdd & 0x0F)) & 0x10) == 0x10) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (((static_cast<uint16_t>(regAValue) + static_cast<uint16_t>(valueToAdd)) > 0x00ff)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.unsetFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::ADD, regAValue, valueToAdd);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
@@ -1082,81 +904,59 @@ public:
 };
 
 // 0xE8
-class ADD_SP_N : public IInstructions
+template <class MEMORY>
+class ADD_SP_N : public BasicInstructions<MEMORY>
 {
 public:
     ADD_SP_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t regValue = memory.get16BitRegister(IMemory::REG16BIT::SP);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t valueToAdd = memory.readInMemory(cursor + 1);
 
-
-        _readableInstructionStream
-            << "add sp,$" << std::hex
-            << static_cast<int>(valueToAdd);
-
+        //signed offset, the carries are out of the low byte
         memory.unsetFlag(IMemory::FLAG::Z);
         memory.unsetFlag(IMemory::FLAG::N);
-        if ((((regValue & 0x0F00) + (valueToAdd & 0x0F00)) & 0x1000) == 0x1000) {
+        if ((regValue & 0x0F) + (valueToAdd & 0x0F) > 0x0F) {
             memory.setFlag(IMemory::FLAG::H);
         }
         else {
             memory.unsetFlag(IMemory::FLAG::H);
         }
-        if (((static_cast<uint32_t>(regValue) + static_cast<uint32_t>(valueToAdd)) > 0xffff)) {
+        if ((regValue & 0xFF) + valueToAdd > 0xFF) {
             memory.setFlag(IMemory::FLAG::C);
         }
         else {
             memory.unsetFlag(IMemory::FLAG::C);
         }
 
-        memory.set16BitRegister(IMemory::REG16BIT::SP, regValue + valueToAdd);
+        memory.set16BitRegister(IMemory::REG16BIT::SP, regValue + static_cast<int8_t>(valueToAdd));
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
     }
 };
 
 // 0x88 0x89 0x8A 0x8B 0x8C 0x8D 0x8F
-class ADC_R : public IInstructions
+template <class MEMORY>
+class ADC_R : public BasicInstructions<MEMORY>
 {
 public:
     ADC_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t valueToAdd = memory.get8BitRegister(_8BitReg);
         uint8_t carryValue = 0x00;
 
-        _readableInstructionStream
-            << "adc a," << debugReg8Bit[_8BitReg];
 
         if (memory.isSetFlag(IMemory::FLAG::C)) {
             carryValue = 0x01;
         }
         uint8_t result = regAValue + valueToAdd + carryValue;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((((regAValue & 0x0F) + (valueToAdd & 0x0F) + (carryValue & 0x0F)) & 0x10) == 0x10) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (((static_cast<uint16_t>(regAValue) + static_cast<uint16_t>(valueToAdd) + carryValue) > 0x00ff)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.unsetFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::ADC, regAValue, valueToAdd, carryValue != 0x00);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -1166,19 +966,18 @@ public:
 };
 
 // 0x8E
-class ADC_ARR : public IInstructions
+template <class MEMORY>
+class ADC_ARR : public BasicInstructions<MEMORY>
 {
 public:
     ADC_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t valueToAdd = memory.readInMemory(adress);
 
-        _readableInstructionStream
-            << "adc a,(hl)";
 
 
         uint8_t carryValue = 0x00;
@@ -1186,25 +985,7 @@ public:
             carryValue = 0x01;
         }
         uint8_t result = regAValue + valueToAdd + carryValue;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((((regAValue & 0x0F) + (valueToAdd & 0x0F) + (carryValue & 0x0F)) & 0x10) == 0x10) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (((static_cast<uint16_t>(regAValue) + static_cast<uint16_t>(valueToAdd) + carryValue) > 0x00ff)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.unsetFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::ADC, regAValue, valueToAdd, carryValue != 0x00);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -1213,46 +994,26 @@ public:
 };
 
 // 0xCE
-class ADC_N : public IInstructions
+template <class MEMORY>
+class ADC_N : public BasicInstructions<MEMORY>
 {
 public:
     ADC_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t valueToAdd = memory.readInMemory(cursor + 1);
 
 
-        _readableInstructionStream
-            << "adc a,(" << std::hex
-            << static_cast<int>(valueToAdd)<< ")";
 
         uint8_t carryValue = 0x00;
         if (memory.isSetFlag(IMemory::FLAG::C)) {
             carryValue = 0x01;
         }
         uint8_t result = regAValue + valueToAdd + carryValue;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((((regAValue & 0x0F) + (valueToAdd & 0x0F) + (carryValue & 0x0F)) & 0x10) == 0x10) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (((static_cast<uint16_t>(regAValue) + static_cast<uint16_t>(valueToAdd) + carryValue) > 0x00ff)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.unsetFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::ADC, regAValue, valueToAdd, carryValue != 0x00);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
@@ -1260,41 +1021,22 @@ public:
 };
 
 // 0x90 0x91 0x92 0x93 0x94 0x95 0x97
-class SUB_R : public IInstructions
+template <class MEMORY>
+class SUB_R : public BasicInstructions<MEMORY>
 {
 public:
     SUB_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t valueToSub = memory.get8BitRegister(_8BitReg);
 
 
-        _readableInstructionStream
-            << "sub " << debugReg8Bit[_8BitReg];
 
         uint8_t result = regAValue - valueToSub;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < (valueToSub & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (regAValue < valueToSub) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SUB, regAValue, valueToSub);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -1304,41 +1046,22 @@ public:
 };
 
 // 0x96
-class SUB_ARR : public IInstructions
+template <class MEMORY>
+class SUB_ARR : public BasicInstructions<MEMORY>
 {
 public:
     SUB_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t valueToSub = memory.readInMemory(adress);
 
 
-        _readableInstructionStream
-            << "sub (hl)";
 
         uint8_t result = regAValue - valueToSub;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < (valueToSub & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (regAValue < valueToSub) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SUB, regAValue, valueToSub);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -1348,42 +1071,22 @@ public:
 };
 
 // 0xD6
-class SUB_N : public IInstructions
+template <class MEMORY>
+class SUB_N : public BasicInstructions<MEMORY>
 {
 public:
     SUB_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t valueToSub = memory.readInMemory(cursor + 1);
 
 
-        _readableInstructionStream
-            << "sub (" << std::hex
-            << static_cast<int>(valueToSub)<< ")";
 
         uint8_t result = regAValue - valueToSub;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < (valueToSub & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (regAValue < valueToSub) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SUB, regAValue, valueToSub);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, result);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
@@ -1391,46 +1094,25 @@ public:
 };
 
 // 0x98 0x99 0x9A 0x9B 0x9C 0x9D 0x9F
-class SBC_R : public IInstructions
+template <class MEMORY>
+class SBC_R : public BasicInstructions<MEMORY>
 {
 public:
     SBC_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t valueToSub = memory.get8BitRegister(_8BitReg);
         uint8_t carryValue = 0x00;
 
-        _readableInstructionStream
-            << "sbc a," << debugReg8Bit[_8BitReg];
 
         if (memory.isSetFlag(IMemory::FLAG::C)) {
             carryValue = 0x01;
         }
         uint8_t resultWithoutCarryOff = regAValue - valueToSub;
-        if ((resultWithoutCarryOff - carryValue) == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < ((valueToSub) & 0x0F)
-            || (resultWithoutCarryOff & 0x0F) < ((carryValue) & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if ((regAValue < valueToSub)
-            || (resultWithoutCarryOff < carryValue)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SBC, regAValue, valueToSub, carryValue != 0x00);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, resultWithoutCarryOff - carryValue);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -1440,46 +1122,25 @@ public:
 };
 
 // 0x9E
-class SBC_ARR : public IInstructions
+template <class MEMORY>
+class SBC_ARR : public BasicInstructions<MEMORY>
 {
 public:
     SBC_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t valueToSub = memory.readInMemory(adress);
         uint8_t carryValue = 0x00;
 
-        _readableInstructionStream
-            << "sbc a,(hl)";
 
         if (memory.isSetFlag(IMemory::FLAG::C)) {
             carryValue = 0x01;
         }
         uint8_t resultWithoutCarryOff = regAValue - valueToSub;
-        if ((resultWithoutCarryOff - carryValue) == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < ((valueToSub) & 0x0F)
-            || (resultWithoutCarryOff & 0x0F) < ((carryValue) & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if ((regAValue < valueToSub)
-            || (resultWithoutCarryOff < carryValue)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SBC, regAValue, valueToSub, carryValue != 0x00);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, resultWithoutCarryOff - carryValue);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -1488,47 +1149,25 @@ public:
 };
 
 // 0xDE
-class SBC_N : public IInstructions
+template <class MEMORY>
+class SBC_N : public BasicInstructions<MEMORY>
 {
 public:
     SBC_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t valueToSub = memory.readInMemory(cursor + 1);
         uint8_t carryValue = 0x00;
 
-        _readableInstructionStream
-            << "sbc a,(" << std::hex
-            << static_cast<int>(valueToSub)<< ")";
 
         if (memory.isSetFlag(IMemory::FLAG::C)) {
             carryValue = 0x01;
         }
         uint8_t resultWithoutCarryOff = regAValue - valueToSub;
-        if ((resultWithoutCarryOff - carryValue) == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < ((valueToSub) & 0x0F)
-            || (resultWithoutCarryOff & 0x0F) < ((carryValue) & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if ((regAValue < valueToSub)
-            || (resultWithoutCarryOff < carryValue)) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SBC, regAValue, valueToSub, carryValue != 0x00);
 
         memory.set8BitRegister(IMemory::REG8BIT::A, resultWithoutCarryOff - carryValue);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
@@ -1536,41 +1175,21 @@ public:
 };
 
 // 0xB8 0xB9 0xBA 0xBB 0xBC 0xBD 0xBF
-class CP_R : public IInstructions
+template <class MEMORY>
+class CP_R : public BasicInstructions<MEMORY>
 {
 public:
     CP_R (int cycles, IMemory::REG8BIT reg8Bit)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _8BitReg(reg8Bit){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint8_t valueToCp = memory.get8BitRegister(_8BitReg);
 
 
-        _readableInstructionStream
-            << "cp " << debugReg8Bit[_8BitReg];
 
-        uint8_t result = regAValue - valueToCp;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < (valueToCp & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (regAValue < valueToCp) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SUB, regAValue, valueToCp);
 
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
@@ -1579,41 +1198,21 @@ public:
 };
 
 // 0xBE
-class CP_ARR : public IInstructions
+template <class MEMORY>
+class CP_ARR : public BasicInstructions<MEMORY>
 {
 public:
     CP_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         uint8_t valueToCp = memory.readInMemory(adress);
 
 
-        _readableInstructionStream
-            << "cp (hl)";
 
-        uint8_t result = regAValue - valueToCp;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < (valueToCp & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (regAValue < valueToCp) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SUB, regAValue, valueToCp);
 
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
@@ -1622,249 +1221,135 @@ public:
 };
 
 // 0xFE
-class CP_N : public IInstructions
+template <class MEMORY>
+class CP_N : public BasicInstructions<MEMORY>
 {
 public:
     CP_N (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t valueToSub = memory.readInMemory(cursor + 1);
 
 
-        _readableInstructionStream
-            << "cp (" << std::hex
-            << static_cast<int>(valueToSub)<< ")";
 
-        uint8_t result = regAValue - valueToSub;
-        if (result == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        if ((regAValue & 0x0F) < (valueToSub & 0x0F)) {
-            memory.setFlag(IMemory::FLAG::H);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::H);
-        }
-        if (regAValue < valueToSub) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        memory.setFlag(IMemory::FLAG::N);
+        memory.setAluFlags(IMemory::ALU_OPERATION::SUB, regAValue, valueToSub);
 
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
     }
 };
 
 // 0x07
-class RLCA : public IInstructions
+template <class MEMORY>
+class RLCA : public BasicInstructions<MEMORY>
 {
 public:
     RLCA (int cycles)
-        :IInstructions(cycles){};
-
-    void doInstructionImpl(IMemory& memory) override {
-        uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
-        std::bitset<8> bitsetA(regAValue);
-
-
-        _readableInstructionStream
-            << "rlca";
-
-        bool isSet = bitsetA[7];
-        bitsetA = bitsetA << 1;
-        if(isSet) {
-            bitsetA[0] = 1;
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetA.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
+        :BasicInstructions<MEMORY>(cycles){};
 
-        memory.set8BitRegister(IMemory::REG8BIT::A, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(IMemory::REG8BIT::A);
+        memory.set8BitRegister(IMemory::REG8BIT::A,
+                               this->setShiftFlags(memory, (value << 1) | (value >> 7), value & 0x80));
+        //unlike the 0xCB rotations, Z is always cleared
+        memory.unsetFlag(IMemory::FLAG::Z);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
     }
 };
 
 // 0x17
-class RLA : public IInstructions
+template <class MEMORY>
+class RLA : public BasicInstructions<MEMORY>
 {
 public:
     RLA (int cycles)
-        :IInstructions(cycles){};
-
-    void doInstructionImpl(IMemory& memory) override {
-
-        _readableInstructionStream
-            << "rla";
-
-        uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
-        std::bitset<8> bitsetA(regAValue);
-        std::bitset<8> rotateBitset = bitsetA << 1;
-        if (memory.isSetFlag(IMemory::FLAG::C)) {
-            rotateBitset[0] = 1;
-        }
-        else {
-            rotateBitset[0] = 0;
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(rotateBitset.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-        if (bitsetA[7] == 1) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-
-        memory.set8BitRegister(IMemory::REG8BIT::A, rotatedValue);
+        :BasicInstructions<MEMORY>(cycles){};
+
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(IMemory::REG8BIT::A);
+        uint8_t carry = memory.isSetFlag(IMemory::FLAG::C);
+        memory.set8BitRegister(IMemory::REG8BIT::A,
+                               this->setShiftFlags(memory, (value << 1) | carry, value & 0x80));
+        //unlike the 0xCB rotations, Z is always cleared
+        memory.unsetFlag(IMemory::FLAG::Z);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
     }
 };
 
-// 0x07
-class RRCA : public IInstructions
+// 0x0F
+template <class MEMORY>
+class RRCA : public BasicInstructions<MEMORY>
 {
 public:
     RRCA (int cycles)
-        :IInstructions(cycles){};
-
-    void doInstructionImpl(IMemory& memory) override {
-
-        _readableInstructionStream
-            << "rrca";
+        :BasicInstructions<MEMORY>(cycles){};
 
-        uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
-        std::bitset<8> bitsetA(regAValue);
-
-        bool isSet = bitsetA[0];
-        bitsetA = bitsetA >> 1;
-        if(isSet) {
-            bitsetA[7] = 1;
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(bitsetA.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-
-        memory.set8BitRegister(IMemory::REG8BIT::A, rotatedValue);
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(IMemory::REG8BIT::A);
+        memory.set8BitRegister(IMemory::REG8BIT::A,
+                               this->setShiftFlags(memory, (value >> 1) | (value << 7), value & 0x01));
+        //unlike the 0xCB rotations, Z is always cleared
+        memory.unsetFlag(IMemory::FLAG::Z);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
     }
 };
 
 // 0x1F
-class RRA : public IInstructions
+template <class MEMORY>
+class RRA : public BasicInstructions<MEMORY>
 {
 public:
     RRA (int cycles)
-        :IInstructions(cycles){};
-
-    void doInstructionImpl(IMemory& memory) override {
-
-        _readableInstructionStream
-            << "rra";
-
-        uint8_t regAValue = memory.get8BitRegister(IMemory::REG8BIT::A);
-        std::bitset<8> bitsetA(regAValue);
-        std::bitset<8> rotateBitset = bitsetA >> 1;
-        if (memory.isSetFlag(IMemory::FLAG::C)) {
-            rotateBitset[7] = 1;
-        }
-        else {
-            rotateBitset[7] = 0;
-        }
-        uint8_t rotatedValue = static_cast<uint8_t>(rotateBitset.to_ulong());
-
-        if (rotatedValue == 0x00) {
-            memory.setFlag(IMemory::FLAG::Z);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::Z);
-        }
-        memory.unsetFlag(IMemory::FLAG::H);
-        memory.unsetFlag(IMemory::FLAG::N);
-        if (bitsetA[0] == 1) {
-            memory.setFlag(IMemory::FLAG::C);
-        }
-        else {
-            memory.unsetFlag(IMemory::FLAG::C);
-        }
-
-        memory.set8BitRegister(IMemory::REG8BIT::A, rotatedValue);
+        :BasicInstructions<MEMORY>(cycles){};
+
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(IMemory::REG8BIT::A);
+        uint8_t carry = memory.isSetFlag(IMemory::FLAG::C);
+        memory.set8BitRegister(IMemory::REG8BIT::A,
+                               this->setShiftFlags(memory, (value >> 1) | (carry << 7), value & 0x01));
+        //unlike the 0xCB rotations, Z is always cleared
+        memory.unsetFlag(IMemory::FLAG::Z);
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 1);
     }
 };
 
 //0xC3
-class JP_NN : public IInstructions
+template <class MEMORY>
+class JP_NN : public BasicInstructions<MEMORY>
 {
 public:
     JP_NN (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t lessSignificantBit = memory.readInMemory(cursor + 1);
         uint8_t(mostSignificantBit) = memory.readInMemory(cursor + 2);
 
         uint16_t adress = (static_cast<uint16_t>(mostSignificantBit) << 8) | lessSignificantBit;
 
-        _readableInstructionStream
-            << "jp $" << std::hex
-            << static_cast<int>(adress);
 
         memory.set16BitRegister(IMemory::REG16BIT::PC, adress);
     }
 };
 
 //0xC2 0xCA 0xD2 0xDA
-class JP_CC_NN : public IInstructions
+template <class MEMORY>
+class JP_CC_NN : public BasicInstructions<MEMORY>
 {
 public:
     JP_CC_NN (int cycles, IMemory::FLAG flag, bool isToBeSet)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _flag(flag),
          _isToBeSet(isToBeSet){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         if (memory.isSetFlag(_flag) == _isToBeSet) {
             uint8_t lessSignificantBit = memory.readInMemory(cursor + 1);
@@ -1872,22 +1357,11 @@ public:
 
             uint16_t adress = (static_cast<uint16_t>(mostSignificantBit) << 8) | lessSignificantBit;
             memory.set16BitRegister(IMemory::REG16BIT::PC, adress);
-            IInstructions::_cycles = 16;
-            _readableInstructionStream
-                << "jp "
-                << (_isToBeSet == 0 ? "n":"")
-                << debugflag[_flag]
-                << ",$" << std::hex
-                << static_cast<int>(adress);
+            this->_cycles = 16;
         }
         else {
             memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 3);
-            IInstructions::_cycles = 12;
-            _readableInstructionStream
-                << "jp "
-                << (_isToBeSet == 0 ? "n":"")
-                << debugflag[_flag]
-                << ",$[condition not met]";
+            this->_cycles = 12;
         }
 
 
@@ -1898,16 +1372,15 @@ public:
 };
 
 //0xE9
-class JP_ARR : public IInstructions
+template <class MEMORY>
+class JP_ARR : public BasicInstructions<MEMORY>
 {
 public:
     JP_ARR (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
 
-        _readableInstructionStream
-            << "jp (hl)";
 
         uint16_t adress = memory.get16BitRegister(IMemory::REG16BIT::HL);
         memory.set16BitRegister(IMemory::REG16BIT::PC, adress);
@@ -1915,55 +1388,41 @@ public:
 };
 
 //0x18
-class JR_N : public IInstructions
+template <class MEMORY>
+class JR_N : public BasicInstructions<MEMORY>
 {
 public:
     JR_N (int cycles)
-        :IInstructions(cycles){};
-
-    void doInstructionImpl(IMemory& memory) override {
-        uint16_t cursor = (memory.get16BitRegister(IMemory::REG16BIT::PC));
-        int8_t toAdd = static_cast<int8_t>(memory.readInMemory(++cursor));
-
-
-        _readableInstructionStream
-            << "jr " << std::hex
-            << static_cast<int>(toAdd);
+        :BasicInstructions<MEMORY>(cycles){};
 
+    void doInstructionImpl(MEMORY& memory) override {
+        uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC) + 1;
+        int8_t toAdd = static_cast<int8_t>(memory.readInMemory(cursor++));
+        //relative to the next instruction
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + toAdd);
     }
 };
 
 //0x20 0x28 0x30 0x38
-class JR_CC_N : public IInstructions
+template <class MEMORY>
+class JR_CC_N : public BasicInstructions<MEMORY>
 {
 public:
     JR_CC_N (int cycles, IMemory::FLAG flag, bool isToBeSet)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _flag(flag),
          _isToBeSet(isToBeSet){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC) + 1;
         int8_t toAdd = static_cast<int8_t>(memory.readInMemory(cursor++));
         if (memory.isSetFlag(_flag) == _isToBeSet) {
             memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + toAdd);
-            IInstructions::_cycles = 12;
-            _readableInstructionStream
-                << "jr "
-                << (_isToBeSet == 0 ? "n":"")
-                << debugflag[_flag]
-                << ",$"<< std::hex
-                << static_cast<int>(toAdd);
+            this->_cycles = 12;
         }
         else {
             memory.set16BitRegister(IMemory::REG16BIT::PC, cursor);
-            IInstructions::_cycles = 8;
-            _readableInstructionStream
-                << "jr "
-                << (_isToBeSet == 0 ? "n":"")
-                << debugflag[_flag]
-                << ",$[condition not met]";
+            this->_cycles = 8;
         }
     }
     IMemory::FLAG _flag;
@@ -1971,13 +1430,14 @@ public:
 };
 
 //0xCD
-class CALL_NN : public IInstructions
+template <class MEMORY>
+class CALL_NN : public BasicInstructions<MEMORY>
 {
 public:
     CALL_NN (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
 
@@ -1994,22 +1454,20 @@ public:
         memory.set16BitRegister(IMemory::REG16BIT::PC, newPCValue);
         memory.set16BitRegister(IMemory::REG16BIT::SP, stackPointer - 2);
 
-        _readableInstructionStream
-            << "call $" << std::hex
-            << static_cast<int>(newPCValue);
     }
 };
 
 //0xC4 0xCC 0xD4 0xDC
-class CALL_CC_NN : public IInstructions
+template <class MEMORY>
+class CALL_CC_NN : public BasicInstructions<MEMORY>
 {
 public:
     CALL_CC_NN (int cycles, IMemory::FLAG flag, bool isToBeSet)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _flag(flag),
          _isToBeSet(isToBeSet){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
         if (memory.isSetFlag(_flag) == _isToBeSet) {
             uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
@@ -2024,21 +1482,11 @@ public:
 
             memory.set16BitRegister(IMemory::REG16BIT::PC, newPCValue);
             memory.set16BitRegister(IMemory::REG16BIT::SP, stackPointer - 2);
-            IInstructions::_cycles = 24;
-            _readableInstructionStream
-                << "call "
-                << (_isToBeSet == 0 ? "n":"")
-                << debugflag[_flag]
-                << ",$"<< std::hex << static_cast<int>(newPCValue);
+            this->_cycles = 24;
         }
         else {
             memory.set16BitRegister(IMemory::REG16BIT::PC, programCounter + 3);
-            IInstructions::_cycles = 12;
-            _readableInstructionStream
-                << "call "
-                << (_isToBeSet == 0 ? "n":"")
-                << debugflag[_flag]
-                << ",$[condition not met]";
+            this->_cycles = 12;
         }
     }
     IMemory::FLAG _flag;
@@ -2046,14 +1494,14 @@ public:
 };
 
 //0xC9
-class RET : public IInstructions
+template <class MEMORY>
+class RET : public BasicInstructions<MEMORY>
 {
 public:
     RET (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "ret";
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
 
         uint8_t lessSignificantBit = memory.readInMemory(stackPointer);
@@ -2066,18 +1514,17 @@ public:
 };
 
 //0xC0 0xC8 0xD0 0xD8
-class RET_CC : public IInstructions
+template <class MEMORY>
+class RET_CC : public BasicInstructions<MEMORY>
 {
 public:
     RET_CC (int cycles, IMemory::FLAG flag, bool isToBeSet)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _flag(flag),
          _isToBeSet(isToBeSet){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         //TODO
-        _readableInstructionStream
-            << "ret " << debugflag[_flag];
         if (memory.isSetFlag(_flag) == _isToBeSet) {
             uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
 
@@ -2087,12 +1534,12 @@ public:
 
             memory.set16BitRegister(IMemory::REG16BIT::PC, newPCValue);
             memory.set16BitRegister(IMemory::REG16BIT::SP, stackPointer +2);
-            IInstructions::_cycles = 20;
+            this->_cycles = 20;
         }
         else {
             uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
             memory.set16BitRegister(IMemory::REG16BIT::PC, programCounter + 1);
-            IInstructions::_cycles = 8;
+            this->_cycles = 8;
         }
     }
     IMemory::FLAG _flag;
@@ -2100,15 +1547,15 @@ public:
 };
 
 //0xD9
-class RETI : public IInstructions
+template <class MEMORY>
+class RETI : public BasicInstructions<MEMORY>
 {
 public:
     RETI (int cycles, IInterruptHandler& interruptHandler)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _interruptHandler(interruptHandler){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "reti";
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
 
         uint8_t lessSignificantBit = memory.readInMemory(stackPointer);
@@ -2125,14 +1572,15 @@ public:
 };
 
 //0xC7 0xD7 0xE7 0xF7 0xCF 0xDF 0xEF 0xFF
-class RST : public IInstructions
+template <class MEMORY>
+class RST : public BasicInstructions<MEMORY>
 {
 public:
     RST (int cycles, uint8_t value)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _value(value){};
 
-    void doInstructionImpl(IMemory& memory) override {
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint16_t stackPointer = memory.get16BitRegister(IMemory::REG16BIT::SP);
 
@@ -2144,22 +1592,19 @@ public:
 
         memory.set16BitRegister(IMemory::REG16BIT::PC, 0x0000 + _value);
         memory.set16BitRegister(IMemory::REG16BIT::SP, stackPointer - 2);
-        _readableInstructionStream 
-            << "rst" << std::hex
-            << static_cast<int>(_value) << "h";
     }
     uint8_t _value;
 };
 
 //0x37
-class SCF : public IInstructions
+template <class MEMORY>
+class SCF : public BasicInstructions<MEMORY>
 {
 public:
     SCF (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "scf";
+    void doInstructionImpl(MEMORY& memory) override {
         memory.unsetFlag(IMemory::FLAG::N);
         memory.unsetFlag(IMemory::FLAG::H);
         memory.setFlag(IMemory::FLAG::C);
@@ -2169,14 +1614,14 @@ public:
 };
 
 //0x3F
-class CCF : public IInstructions
+template <class MEMORY>
+class CCF : public BasicInstructions<MEMORY>
 {
 public:
     CCF (int cycles)
-        :IInstructions(cycles){};
+        :BasicInstructions<MEMORY>(cycles){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "ccf";
+    void doInstructionImpl(MEMORY& memory) override {
         memory.unsetFlag(IMemory::FLAG::N);
         memory.unsetFlag(IMemory::FLAG::H);
         if (memory.isSetFlag(IMemory::FLAG::C)) {
@@ -2191,18 +1636,16 @@ public:
 };
 
 //0x2F
-class CPL : public IInstructions
+template <class MEMORY>
+class CPL : public BasicInstructions<MEMORY>
 {
 public:
     CPL (int cycles)
-        :IInstructions(cycles){};
-
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "cpl";
-        std::bitset<8> bitsetA(memory.get8BitRegister(IMemory::REG8BIT::A));
-        bitsetA.flip();
-        uint8_t newValue = static_cast<uint8_t>(bitsetA.to_ulong());
-        memory.set8BitRegister(IMemory::REG8BIT::A, newValue);
+        :BasicInstructions<MEMORY>(cycles){};
+
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(IMemory::REG8BIT::A);
+        memory.set8BitRegister(IMemory::REG8BIT::A, ~value);
         memory.setFlag(IMemory::FLAG::N);
         memory.setFlag(IMemory::FLAG::H);
         uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
@@ -2210,16 +1653,50 @@ public:
     }
 };
 
+//0x27
+template <class MEMORY>
+class DAA : public BasicInstructions<MEMORY>
+{
+public:
+    DAA (int cycles)
+        :BasicInstructions<MEMORY>(cycles){};
+
+    //BCD correction of A after an addition or a subtraction
+    void doInstructionImpl(MEMORY& memory) override {
+        uint8_t value = memory.get8BitRegister(IMemory::REG8BIT::A);
+        bool isSub = memory.isSetFlag(IMemory::FLAG::N);
+        uint8_t correction = 0;
+        if (memory.isSetFlag(IMemory::FLAG::H) || (!isSub && (value & 0x0F) > 0x09)) {
+            correction |= 0x06;
+        }
+        if (memory.isSetFlag(IMemory::FLAG::C) || (!isSub && value > 0x99)) {
+            correction |= 0x60;
+            memory.setFlag(IMemory::FLAG::C);
+        }
+        value = isSub ? value - correction : value + correction;
+        memory.set8BitRegister(IMemory::REG8BIT::A, value);
+        if (value == 0x00) {
+            memory.setFlag(IMemory::FLAG::Z);
+        }
+        else {
+            memory.unsetFlag(IMemory::FLAG::Z);
+        }
+        memory.unsetFlag(IMemory::FLAG::H);
+        uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
+        memory.set16BitRegister(IMemory::REG16BIT::PC, programCounter + 1);
+    }
+};
+
 //0xF3
-class DI : public IInstructions
+template <class MEMORY>
+class DI : public BasicInstructions<MEMORY>
 {
 public:
     DI (int cycles, IInterruptHandler& interruptHandler)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _interruptHandler(interruptHandler){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "di";
+    void doInstructionImpl(MEMORY& memory) override {
         _interruptHandler.disableMasterSwitch();
         uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, programCounter + 1);
@@ -2228,15 +1705,15 @@ public:
 };
 
 //0xFB
-class EI : public IInstructions
+template <class MEMORY>
+class EI : public BasicInstructions<MEMORY>
 {
 public:
     EI (int cycles, IInterruptHandler& interruptHandler)
-        :IInstructions(cycles),
+        :BasicInstructions<MEMORY>(cycles),
          _interruptHandler(interruptHandler){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "ei";
+    void doInstructionImpl(MEMORY& memory) override {
         _interruptHandler.enableMasterSwitch();
         uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, programCounter + 1);
@@ -2245,54 +1722,59 @@ public:
 };
 
 //0x76
-class HALT : public IInstructions
+template <class MEMORY>
+class HALT : public BasicInstructions<MEMORY>
 {
 public:
-    HALT (int cycles)
-        :IInstructions(cycles){};
+    HALT (int cycles, IInterruptHandler& interruptHandler)
+        :BasicInstructions<MEMORY>(cycles),
+         _interruptHandler(interruptHandler){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "halt";
-        //TODO
+    void doInstructionImpl(MEMORY& memory) override {
+        _interruptHandler.halt();
         uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
         memory.set16BitRegister(IMemory::REG16BIT::PC, programCounter + 1);
     }
+    IInterruptHandler& _interruptHandler;
 };
 
-//0x10
-class STOP : public IInstructions
+//0x10, no joypad yet, so waits like HALT
+template <class MEMORY>
+class STOP : public BasicInstructions<MEMORY>
 {
 public:
-    STOP (int cycles)
-        :IInstructions(cycles){};
+    STOP (int cycles, IInterruptHandler& interruptHandler)
+        :BasicInstructions<MEMORY>(cycles),
+         _interruptHandler(interruptHandler){};
 
-    void doInstructionImpl(IMemory&) override {
-        _readableInstructionStream << "stop";
-        //TODO
+    void doInstructionImpl(MEMORY& memory) override {
+        _interruptHandler.halt();
+        uint16_t programCounter = memory.get16BitRegister(IMemory::REG16BIT::PC);
+        memory.set16BitRegister(IMemory::REG16BIT::PC, programCounter + 2);
     }
+    IInterruptHandler& _interruptHandler;
 };
 
 //0xCB
-class OP : public IInstructions
+template <class MEMORY>
+class OP : public BasicInstructions<MEMORY>
 {
 public:
-    OP (int cycles, std::map<uint8_t, std::shared_ptr<IInstructions>> const & binaryInstructions)
-        :IInstructions(cycles),
-         _binaryInstructions(binaryInstructions){};
+    OP (int cycles, BasicDispatchTable<MEMORY> const & dispatchTable)
+        :BasicInstructions<MEMORY>(cycles),
+         _dispatchTable(dispatchTable){};
 
-    void doInstructionImpl(IMemory& memory) override {
-        _readableInstructionStream << "cb";
+    void doInstructionImpl(MEMORY& memory) override {
         uint16_t cursor = memory.get16BitRegister(IMemory::REG16BIT::PC);
         uint8_t opCode = memory.readInMemory(cursor + 1);
 
-        auto instructMapIt = _binaryInstructions.find(opCode);
-        if (instructMapIt != _binaryInstructions.end()) {
-            std::shared_ptr<IInstructions> binaryInstruction = instructMapIt->second;
+        BasicInstructions<MEMORY>* binaryInstruction = _dispatchTable[binaryInstructionsOffset + opCode];
+        if (binaryInstruction != nullptr) {
             int binaryInstructionCycle = binaryInstruction->doOp(memory);
-            IInstructions::_cycles = 4 + binaryInstructionCycle;
+            this->_cycles = 4 + binaryInstructionCycle;
         }
         memory.set16BitRegister(IMemory::REG16BIT::PC, cursor + 2);
     }
-    std::map<uint8_t, std::shared_ptr<IInstructions>> const & _binaryInstructions;
+    BasicDispatchTable<MEMORY> const & _dispatchTable;
 };
 #endif /*INSTRUCTIONS*/
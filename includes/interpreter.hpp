@@ -0,0 +1,96 @@
+#ifndef _INTERPRETER_
+#define _INTERPRETER_
+
+#include "iinstructionhandler.hpp"
+#include "iinterupthandler.hpp"
+#include "memory.hpp"
+#include "profiler.hpp"
+
+//Single function cpu core working straight on the register file.
+//Behaves like the IInstructions classes, which stay the reference
+//implementation (and the only one filling the readable instruction).
+class Interpreter : public IInstructionHandler
+{
+public:
+
+    Interpreter(Memory& memory, IInterruptHandler& interruptHandler);
+    int doInstruction(uint8_t opCode) override;
+    void setProfiler(Profiler* profiler) override;
+    //runs opCode with an already fetched operand (0 to 2 bytes, little endian)
+    int execute(uint8_t opCode, uint16_t operand);
+
+    static uint8_t getInstructionLength(uint8_t opCode);
+    //cycles execute may return for opCode, branch taken
+    static uint8_t getMaxCycles(uint8_t opCode);
+
+    //superinstructions, run by BlockCache in place of the instructions
+    //they start with, for the cycles of all of them
+    //8 bit ALU or INC/DEC r, then JR cc,e
+    int aluJumpRelative(uint8_t opCode, uint16_t operand, uint8_t jumpOpCode, uint8_t offset);
+    //LD A,(HL+) or (HL-), then LD (BC) or (DE),A
+    int copyByte(uint8_t loadOpCode, uint8_t storeOpCode);
+    //LDH A,(n), then CP n
+    int loadCompare(uint8_t adress, uint8_t value);
+    //LDH A,(n), CP n, then JR cc,e
+    int loadCompareJump(uint8_t adress, uint8_t value, uint8_t jumpOpCode, uint8_t offset);
+
+private:
+
+#if GB_PROFILE
+    //execute without the profiler
+    int dispatch(uint8_t opCode, uint16_t operand);
+#endif
+    int doBinaryInstruction(uint8_t opCode);
+    int next(uint16_t length, int cycles);
+
+    uint8_t readNext8Bit();
+    uint16_t readNext16Bit();
+    void push(uint16_t value);
+    uint16_t pop();
+
+    //replaces the flags of mask in one write, flags built with flagIf
+    void setFlags(uint8_t mask, uint8_t flags);
+    static uint8_t flagIf(IMemory::FLAG flag, bool isSet);
+    bool isSetFlag(IMemory::FLAG flag);
+
+    uint8_t incDec(uint8_t value, int toAdd);
+    void incDec16Bit(uint16_t& value, int toAdd);
+    void add(uint8_t value);
+    void adc(uint8_t value);
+    void sub(uint8_t value);
+    void sbc(uint8_t value);
+    void cp(uint8_t value);
+    void logicalAnd(uint8_t value);
+    void logicalXor(uint8_t value);
+    void logicalOr(uint8_t value);
+    void addToHL(uint16_t value);
+    uint16_t addToSP(uint8_t offset);
+    void decimalAdjust();
+
+    uint8_t setShiftFlags(uint8_t result, bool carry);
+    uint8_t rotateLeftCarry(uint8_t value);
+    uint8_t rotateRightCarry(uint8_t value);
+    uint8_t rotateLeft(uint8_t value);
+    uint8_t rotateRight(uint8_t value);
+    uint8_t shiftLeft(uint8_t value);
+    uint8_t shiftRightArithmetic(uint8_t value);
+    uint8_t shiftRightLogical(uint8_t value);
+    uint8_t swap(uint8_t value);
+
+    int jumpIf(bool condition);
+    int jumpRelativeIf(bool condition);
+    //condition of JR cc, JP cc, CALL cc and RET cc
+    bool isConditionMet(uint8_t opCode);
+    int callIf(bool condition);
+    int retIf(bool condition);
+    int restart(uint16_t adress);
+
+    Memory& _memory;
+    Registers& _registers;
+    IInterruptHandler& _interruptHandler;
+    //0xCB opCode low 3 bits -> B C D E H L (HL) A, nullptr for (HL)
+    uint8_t* const _binaryRegisters[8];
+    uint16_t _operand = 0;
+    Profiler* _profiler = nullptr;
+};
+#endif /*INTERPRETER*/
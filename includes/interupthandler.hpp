@@ -4,25 +4,31 @@
 #include <bitset>
 #include "imemory.hpp"
 #include "iinterupthandler.hpp"
+#include "ischeduler.hpp"
 
 
-class InterruptHandler : public IInterruptHandler
+template <class MEMORY>
+class BasicInterruptHandler : public IInterruptHandler
 {
 public:
 
-    InterruptHandler(IMemory& memory);
+    BasicInterruptHandler(MEMORY& memory);
+    //woken when the master switch gets enabled
+    void setScheduler(IScheduler* scheduler);
     void doInterrupt() override;
     bool isMasterSwitchEnabled() override;
     void enableMasterSwitch() override;
     void disableMasterSwitch() override;
     void requestInterrupt(IInterruptHandler::INTERRUPT id) override;
-    // void halt();
-    // void stop();
+    void halt() override;
 
 
 private:
     void serviceInterrupt(IInterruptHandler::INTERRUPT id, std::bitset<8> bitsetRequest);
 
-    IMemory& _memory;
+    MEMORY& _memory;
+    IScheduler* _scheduler = nullptr;
 };
+
+using InterruptHandler = BasicInterruptHandler<IMemory>;
 #endif /*INTERRUPTHANDLER*/
@@ -0,0 +1,31 @@
+#ifndef _ISCHEDULER_
+#define _ISCHEDULER_
+
+#include <cstdint>
+#include <limits>
+
+//Told by Memory and the interrupt handler when a write changes what
+//a component would do on its next update
+class IScheduler
+{
+public:
+
+    //components due on the same instruction run in this order,
+    //the order Cpu::nextStep used to update them in
+    enum class EVENT
+        {
+            TIMER,
+            SCANLINE,
+            INTERRUPT
+        };
+
+    virtual ~IScheduler() = default;
+    //runs the component at the end of the current instruction
+    virtual void wake(EVENT event) = 0;
+    //master clock, in cycles, up to the latest instruction boundary
+    virtual uint64_t getCycles() = 0;
+
+    static int const _eventCount = 3;
+    static uint64_t const _never = std::numeric_limits<uint64_t>::max();
+};
+#endif /*ISCHEDULER*/
@@ -22,7 +22,6 @@ public:
 protected:
 
     int _cycleCounter = 1024;
-    int _dividerRegister = 0;
     uint32_t const _clockSpeed = 4194304;
 
     std::map<uint8_t, uint32_t> const _speed = {
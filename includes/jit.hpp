@@ -0,0 +1,93 @@
+#ifndef _JIT_
+#define _JIT_
+
+#include <vector>
+#include "blockcache.hpp"
+
+//native code is only generated for x86-64 linux,
+//everywhere else the Jit keeps interpreting its blocks
+#if defined(__x86_64__) && defined(__linux__)
+#define GB_JIT_X86_64
+#endif
+
+//Block cache translating hot blocks into x86-64 code.
+//Loads, stores, 8 bit ALU, INC/DEC and jumps are emitted natively with the
+//flags taken from the x86 ones, every other opCode calls back into the
+//Interpreter. The scheduler is asked once per block run for the cycles
+//left before its next event, the native code leaves ahead of the first
+//instruction that could reach it and the scheduler is then moved once.
+//The memory accesses bring it up to their instruction when they touch the
+//IO registers, and a block is left right after a write woke a component
+//or removed the block, so the components see the same state as stepping them.
+class Jit : public BlockCache
+{
+public:
+
+    struct NativeStats
+    {
+        uint64_t nativeRuns = 0;
+        uint32_t compiledBlocks = 0;
+        uint32_t codeFlushes = 0;
+    };
+
+    Jit(Memory& memory, IInterruptHandler& interruptHandler);
+    ~Jit();
+
+    //interprets the block when it is not compiled yet
+    //or an event is due in its first instruction
+    int run() override;
+    //false falls back to interpreting every block
+    void setEnabled(bool isEnabled);
+    bool isEnabled() const;
+    static bool isSupported();
+
+    void clear() override;
+    NativeStats const & getNativeStats() const;
+
+    //runs before a block gets compiled
+    static uint32_t const _hotThreshold = 8;
+    static size_t const _codeSize = 4 << 20;
+
+private:
+
+    //given the cycles left before the next event, returns the
+    //cycles run with the instructions run in the upper 16 bits
+    using NativeCode = uint32_t (*)(Registers*, Jit*, int);
+
+    struct NativeBlock
+    {
+        NativeCode code = nullptr;
+        uint32_t runs = 0;
+    };
+
+    void removeBlock(uint16_t startPc) override;
+    int runNative(Block const & block, NativeCode code, int budget);
+    NativeCode compile(Block const & block);
+    //moves the scheduler up to cycles into the running block
+    void sync(int cycles);
+    //after a write or an interpreted instruction, the return value of the
+    //native code ending there when the block has to be left, 0 otherwise
+    uint32_t leaveIfNeeded(int cycles, int index, bool isLeaving);
+
+    //called from the generated code, cyclesBefore are the cycles of the
+    //block before the instruction, index its place in the block and
+    //cycles those the following instructions were compiled with
+    static uint32_t executeCallback(Jit* jit, int opCode, int operand, int cyclesBefore, int index, int cycles);
+    static int readCallback(Jit* jit, int adress, int cyclesBefore);
+    static uint32_t writeCallback(Jit* jit, int data, int adress, int cyclesBefore, int cycles, int index);
+
+    std::vector<NativeBlock> _nativeBlocks;
+    bool _isEnabled = true;
+    NativeStats _nativeStats;
+
+    //state of the native block running
+    int _runningLength = 0;
+    //cycles left before the next event when the block started
+    int _runningBudget = 0;
+    int _syncedCycles = 0;
+
+    uint8_t* _code = nullptr;
+    size_t _codeUsed = 0;
+    size_t _pageSize = 0x1000;
+};
+#endif /*JIT*/
@@ -0,0 +1,16 @@
+#ifndef _LOG_
+#define _LOG_
+
+#include <boost/log/trivial.hpp>
+
+//lowest boost log severity compiled in, from 0 (trace) to 5 (fatal).
+//Set by the GB_LOG_LEVEL CMake option, below it GB_LOG statements
+//are removed at compile time instead of being filtered at run time.
+#ifndef GB_LOG_LEVEL
+#define GB_LOG_LEVEL 2
+#endif
+
+#define GB_LOG(severity)                                                \
+    if (boost::log::trivial::severity < GB_LOG_LEVEL) {}                \
+    else BOOST_LOG_TRIVIAL(severity)
+#endif /*LOG*/
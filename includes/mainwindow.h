@@ -15,6 +15,7 @@
 #include "fileio.hpp"
 #include "romloader.hpp"
 #include "cpu.hpp"
+#include "qtcpu.hpp"
 
 namespace Ui {
   class MainWindow;
@@ -63,6 +64,8 @@ private:
     std::unique_ptr<FileIO>    _fileIO;
     std::unique_ptr<RomLoader> _romLoader;
     std::unique_ptr<Cpu>       _cpu;
+    //destroyed first, it is declared after _cpu
+    std::unique_ptr<QtCpu>     _qtCpu;
 
     struct Cell {
         int row;
@@ -84,6 +87,8 @@ private:
 
     Cell              _previousPcValueCell;
     std::vector<Cell> _dataFetchFocus;
+    //refreshed as a whole for the memory table
+    IMemory::RomData  _memorySnapshot;
 };
 
 #endif // MAINWINDOW_H
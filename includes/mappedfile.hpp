@@ -0,0 +1,37 @@
+#ifndef _MAPPEDFILE_
+#define _MAPPEDFILE_
+
+#include <cstddef>
+#include <cstdint>
+
+//Shared mapping of a whole file. The pages come from the page cache on
+//first access, so mapping is the same cost for any file size and the
+//processes mapping the same file share its pages. Read only for the roms,
+//writable for the save files, the writes reaching the file once synced.
+class MappedFile
+{
+public:
+
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(MappedFile const &) = delete;
+    MappedFile& operator=(MappedFile const &) = delete;
+
+    //false for an empty file or when the mapping fails
+    bool map(int fd);
+    //the file is grown to size first, fd must be opened read write
+    bool mapWritable(int fd, size_t size);
+    uint8_t const * getData() const;
+    //nullptr unless mapped writable
+    uint8_t* getWritableData();
+    size_t getSize() const;
+    //waits for the pages holding these bytes to be written to the file
+    bool sync(size_t offset, size_t size);
+
+private:
+
+    uint8_t* _data = nullptr;
+    bool _isWritable = false;
+    size_t _size = 0;
+};
+#endif /*MAPPEDFILE*/
@@ -1,14 +1,19 @@
 #ifndef _MEMORY_
 #define _MEMORY_
 
-#include <map>
-#include <bitset>
+#include <array>
 #include <exception>
+#include <memory>
+#include <vector>
 #include "imemory.hpp"
+#include "memorybankcontroller.hpp"
+#include "savefile.hpp"
 #include "itimer.hpp"
+#include "icodecache.hpp"
+#include "ischeduler.hpp"
 
 
-class Memory : public IMemory
+class Memory final : public IMemory
 {
 public:
 
@@ -28,65 +33,183 @@ public:
     };
 
     Memory();
-    void setTimer(ITimer* timer);
-    void incrementDividerRegister() override;
+    //the pages point into this object
+    Memory(Memory const &) = delete;
+    Memory& operator=(Memory const &) = delete;
+    //only one code cache is told about writes
+    void setCodeCache(ICodeCache* codeCache);
+    //woken by the writes to the timer, lcd and interrupt registers
+    void setScheduler(IScheduler* scheduler);
+    //direct register file access for the Interpreter core
+    Registers& getRegisters();
+    //alu flags are only computed once F is read, for the cores going
+    //through IMemory (the Interpreter reads the register file directly)
+    void setLazyFlags(bool isLazy);
+    //ioHandler for 0xff00 to 0xff7f
+    void setIoHandler(uint16_t adress, IIoHandler* handler) override;
     void incrementScanline() override;
 
-    CartridgeData const  getCartridge() override;
-    RomData const  getReadOnlyMemory() override;
+    CartridgeData const & getCartridge() override;
     bool setCartridge(CartridgeData const & cartridge) override;
     State getState() override;
+    RegisterState getRegisterState() override;
+    //the 64KB copied page by page, the mapped pages in one copy each,
+    //cheaper than a MemoryView for the tables showing them all
+    void copyMemory(RomData& snapshot);
+    //0 unless the cartridge ram has a battery
+    size_t getBatteryRamSize() const;
+    //the cartridge ram is read and written in the save file until the
+    //next cartridge, false when it has no battery or the file is too small
+    bool setSaveFile(std::shared_ptr<SaveFile> saveFile);
     bool writeInMemory(uint8_t data, uint16_t adress) override;
-    uint8_t readInMemory(uint16_t adress) override;
+    //defined here so the cores built on Memory can inline it, one shift
+    //and one load unless the page has no read pointer
+    uint8_t readInMemory(uint16_t adress) override
+    {
+        uint8_t const * page = _readPages[adress >> 8];
+        if (page != nullptr) {
+            return page[adress & 0xff];
+        }
+        //hram shares the io page, only the io registers and IE are slow
+        if (adress >= 0xff80 && adress != 0xffff) {
+            return _readOnlyMemory[adress];
+        }
+        return readSlow(adress);
+    }
+
+    //one array index, defined here to be inlined as well
+    void set8BitRegister(REG8BIT reg,uint8_t value) override
+    {
+        if (reg == REG8BIT::F) {
+            _hasPendingFlags = false;
+        }
+        *_8BitRegisters[static_cast<int>(reg)] = value;
+    }
+
+    void set16BitRegister(REG16BIT reg,uint16_t value) override
+    {
+        if (reg == REG16BIT::AF) {
+            _hasPendingFlags = false;
+        }
+        *_16BitRegisters[static_cast<int>(reg)] = value;
+    }
 
-    void set8BitRegister(REG8BIT reg,uint8_t value) override;
-    void set16BitRegister(REG16BIT reg,uint16_t value) override;
-    uint8_t get8BitRegister(REG8BIT reg) override;
-    uint16_t get16BitRegister(REG16BIT reg) override;
+    uint8_t get8BitRegister(REG8BIT reg) override
+    {
+        if (reg == REG8BIT::F) {
+            materializeFlags();
+        }
+        return *_8BitRegisters[static_cast<int>(reg)];
+    }
 
-    void setFlag(IMemory::FLAG flag) override;
-    void unsetFlag(IMemory::FLAG flag) override;
-    bool isSetFlag(IMemory::FLAG flag) override;
+    uint16_t get16BitRegister(REG16BIT reg) override
+    {
+        if (reg == REG16BIT::AF) {
+            materializeFlags();
+        }
+        return *_16BitRegisters[static_cast<int>(reg)];
+    }
+
+    void setFlag(IMemory::FLAG flag) override
+    {
+        materializeFlags();
+        _registers.f |= 1 << static_cast<int>(flag);
+    }
+
+    void unsetFlag(IMemory::FLAG flag) override
+    {
+        materializeFlags();
+        _registers.f &= ~(1 << static_cast<int>(flag));
+    }
+
+    bool isSetFlag(IMemory::FLAG flag) override
+    {
+        materializeFlags();
+        return (_registers.f >> static_cast<int>(flag)) & 0x01;
+    }
 
     void unsetBitInRegister(int bit, REG8BIT reg) override;
     void setBitInRegister(int bit, REG8BIT reg) override;
     bool isSet(int bit, REG8BIT reg) override;
 
+    void setAluFlags(ALU_OPERATION operation, uint8_t value, uint8_t operand, bool carry = false) override;
+
 private:
 
+    struct AluOperation
+    {
+        ALU_OPERATION operation;
+        uint8_t value;
+        uint8_t operand;
+        bool carry;
+    };
+
     bool reset();
-    bool fillROM();
+    void mapPages();
+    //remaps after a bank switch, the code cached in a window that
+    //changed is dropped
+    void switchBanks();
+    uint8_t readSlow(uint16_t adress);
+    bool writeSlow(uint8_t data, uint16_t adress);
+    void invalidateCode(uint16_t adress);
+    void invalidateCode(uint16_t adress, size_t size);
     void initializeMemory();
     template <class ARRAY>
     bool isEmpty(ARRAY const & memory);
-    void dmaTransfer(uint8_t data);
+    static CartridgeData const & getBlankCartridge();
+    void wakeScheduler(uint8_t data, uint16_t adress);
+    uint8_t* getExternalRam();
+    void materializeFlags()
+    {
+        if (_hasPendingFlags) {
+            _hasPendingFlags = false;
+            AluOperation const & pending = _pendingFlags;
+            uint8_t mask = getAluFlagsMask(pending.operation);
+            _registers.f = (_registers.f & ~mask)
+                | computeAluFlags(pending.operation, pending.value, pending.operand, pending.carry);
+        }
+    }
 
     Registers _registers;
+    //shared with the rom loader, mapped read only
     CartridgeData _cartridge;
+    //the adresses from 0x8000, the rom is read from the cartridge
     RomData _readOnlyMemory;
-    // unique_ptr<ITimer> _timer;
-    ITimer* _timer;
+    MemoryBankController _bankController;
+    //the cartridge ram banks, mapped at 0xa000
+    std::vector<uint8_t> _externalRam;
+    //replaces _externalRam for the battery backed ram
+    std::shared_ptr<SaveFile> _saveFile;
+    //one entry per 256 bytes page, nullptr takes the slow path: the rom
+    //writes for the bank controller, the cartridge ram when disabled or
+    //on the clock and its writes to a save file, the oam and the io
+    //page, whose hram is then served inline
+    std::array<uint8_t const *, 0x100> _readPages{};
+    std::array<uint8_t*, 0x100> _writePages{};
+    //indexed by the low 7 bits of the io adress
+    std::array<IIoHandler*, 0x80> _ioHandlers{};
+    ICodeCache* _codeCache = nullptr;
+    IScheduler* _scheduler = nullptr;
+    bool _isLazyFlags = false;
+    bool _hasPendingFlags = false;
+    AluOperation _pendingFlags;
 
-    std::map<IMemory::REG8BIT, uint8_t*> _8BitRegisters =
-        {
-            {IMemory::REG8BIT::A, &_registers.a},
-            {IMemory::REG8BIT::B, &_registers.b},
-            {IMemory::REG8BIT::C, &_registers.c},
-            {IMemory::REG8BIT::D, &_registers.d},
-            {IMemory::REG8BIT::E, &_registers.e},
-            {IMemory::REG8BIT::F, &_registers.f},
-            {IMemory::REG8BIT::H, &_registers.h},
-            {IMemory::REG8BIT::L, &_registers.l}
-        };
-    std::map<IMemory::REG16BIT, uint16_t*> _16BitRegisters =
-        {
-            {IMemory::REG16BIT::AF, &_registers.af},
-            {IMemory::REG16BIT::BC, &_registers.bc},
-            {IMemory::REG16BIT::DE, &_registers.de},
-            {IMemory::REG16BIT::HL, &_registers.hl},
-            {IMemory::REG16BIT::PC, &_registers.pc},
-            {IMemory::REG16BIT::SP, &_registers.sp}
-        };
-    //TODO MemoryBankController
+    //indexed by REG8BIT and REG16BIT, in their declaration order
+    std::array<uint8_t*, 8> const _8BitRegisters =
+        {{
+            &_registers.a, &_registers.f,
+            &_registers.b, &_registers.c,
+            &_registers.d, &_registers.e,
+            &_registers.h, &_registers.l
+        }};
+    std::array<uint16_t*, 6> const _16BitRegisters =
+        {{
+            &_registers.af,
+            &_registers.bc,
+            &_registers.de,
+            &_registers.hl,
+            &_registers.sp,
+            &_registers.pc
+        }};
 };
 #endif /*MEMORY*/
@@ -0,0 +1,85 @@
+#ifndef _MEMORYBANKCONTROLLER_
+#define _MEMORYBANKCONTROLLER_
+
+#include <array>
+#include <cstdint>
+#include <ctime>
+
+//Bank registers of the cartridge, written through the rom adresses.
+//Memory maps the banks it gives at 0x0000, 0x4000 and 0xa000 into its
+//pages, so a switch only moves pointers into the cartridge and the ram.
+class MemoryBankController
+{
+public:
+
+    enum class TYPE
+        {
+            NONE,
+            MBC1,
+            MBC3,
+            MBC5
+        };
+
+    //from the cartridge header
+    static TYPE getType(uint8_t cartridgeType);
+    static size_t getRomBanks(uint8_t romSize);
+    static size_t getRamBanks(uint8_t ramSize);
+    //the ram is kept in a save file while the game is off
+    static bool hasBattery(uint8_t cartridgeType);
+
+    static size_t const romBankSize = 0x4000;
+    static size_t const ramBankSize = 0x2000;
+
+    MemoryBankController(TYPE type = TYPE::NONE, size_t romBanks = 2, size_t ramBanks = 1);
+
+    //returns true when the banks mapped changed
+    bool write(uint8_t data, uint16_t adress);
+    TYPE getType() const;
+    size_t getRamSize() const;
+    size_t getRomBank0() const;
+    size_t getRomBank() const;
+    size_t getRamBank() const;
+    //ram enabled and a ram bank mapped, not a clock register
+    bool isRamMapped() const;
+    bool isClockMapped() const;
+
+    //mbc3 clock register selected at 0xa000, the latched value is read
+    uint8_t readClock() const;
+    void writeClock(uint8_t data);
+
+private:
+
+    enum CLOCK
+        {
+            SECONDS,
+            MINUTES,
+            HOURS,
+            DAY_LOW,
+            DAY_HIGH
+        };
+
+    uint64_t getClockSeconds() const;
+    void setClockSeconds(uint64_t seconds);
+    std::array<uint8_t, 5> getClockRegisters() const;
+
+    TYPE _type;
+    size_t _romBanks;
+    size_t _ramBanks;
+
+    bool _isRamEnabled;
+    //mbc1 5 bits, mbc3 7 bits, mbc5 9 bits
+    uint16_t _romBank = 1;
+    //mbc1 upper rom bits or ram bank, mbc3 ram bank or clock register
+    uint8_t _ramBank = 0;
+    bool _isAdvancedMode = false;
+
+    //seconds counted up to _clockStart, the counting goes on from there
+    //unless halted
+    uint64_t _clockSeconds = 0;
+    std::time_t _clockStart = 0;
+    bool _isClockHalted = false;
+    bool _isDayCarry = false;
+    uint8_t _latch = 0xff;
+    std::array<uint8_t, 5> _latchedClock{};
+};
+#endif /*MEMORYBANKCONTROLLER*/
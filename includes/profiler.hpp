@@ -0,0 +1,60 @@
+#ifndef _PROFILER_
+#define _PROFILER_
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+//1 compiles in the calls to Profiler::record in the cores, set by the
+//GB_PROFILE CMake option. At 0 they are removed and a Profiler given
+//to setProfiler stays empty.
+#ifndef GB_PROFILE
+#define GB_PROFILE 0
+#endif
+
+//Executions and cycles of each base and 0xCB opCode, and executions of
+//each PC. Cycles skipped while halted or in a polling loop are not
+//instructions and are left out, and so are the instructions of the
+//blocks the JIT runs natively.
+class Profiler
+{
+public:
+
+    struct Counter
+    {
+        uint64_t executions = 0;
+        uint64_t cycles = 0;
+    };
+
+    Profiler();
+
+    //cbOpCode is the byte after opCode, only used when opCode is 0xCB
+    void record(uint16_t pc, uint8_t opCode, uint8_t cbOpCode, int cycles)
+    {
+        Counter& counter = opCode == 0xCB ? _cbCounters[cbOpCode] : _counters[opCode];
+        counter.executions++;
+        counter.cycles += cycles;
+        _pcHits[pc]++;
+    }
+    void reset();
+
+    Counter const & getCounter(uint8_t opCode) const;
+    Counter const & getCbCounter(uint8_t opCode) const;
+    uint64_t getPcHits(uint16_t pc) const;
+    Counter getTotal() const;
+
+    //opCodes and PCs that ran at least once, the cycle share in percent
+    void writeCsv(std::ostream& stream) const;
+    void writeJson(std::ostream& stream) const;
+    //.json files get writeJson, the others writeCsv
+    bool dump(std::string const & fileName) const;
+
+private:
+
+    std::array<Counter, 0x100> _counters;
+    std::array<Counter, 0x100> _cbCounters;
+    std::vector<uint64_t> _pcHits;
+};
+#endif /*PROFILER*/
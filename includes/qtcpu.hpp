@@ -0,0 +1,25 @@
+#ifndef _QTCPU_
+#define _QTCPU_
+
+#include <QObject>
+#include "cpu.hpp"
+#include "iframeobserver.hpp"
+
+//Qt side of a Cpu, turns its completed frames into the screen_refresh signal
+class QtCpu : public QObject, public IFrameObserver
+{
+    Q_OBJECT
+public:
+
+    QtCpu(Cpu& cpu);
+    ~QtCpu();
+    void frameCompleted(std::vector<std::vector<RGB>> const & screen) override;
+
+signals:
+    void screen_refresh();
+
+private:
+
+    Cpu& _cpu;
+};
+#endif /*QTCPU*/
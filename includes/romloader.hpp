@@ -1,6 +1,7 @@
 #ifndef _ROMLOADER_
 #define _ROMLOADER_
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "ifileio.hpp"
@@ -14,6 +15,7 @@ public:
     IMemory::CartridgeData getData();
 private:
     IFileIO& _fileIO;
+    //the mapped rom file when it could be mapped
     IMemory::CartridgeData _data;
 
 };
@@ -0,0 +1,63 @@
+#ifndef _SAVEFILE_
+#define _SAVEFILE_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "mappedfile.hpp"
+
+//Battery backed cartridge ram, mapped from the .sav file next to the rom.
+//The emulation thread writes the mapping and marks the pages it wrote,
+//a thread of its own syncs the marked pages to the file every flush
+//interval. A save never waits on the disk and a crash loses at most the
+//writes of the last interval.
+class SaveFile
+{
+public:
+
+    //the rom name with the .sav extension
+    static std::string getPath(std::string const & romName);
+
+    explicit SaveFile(std::chrono::milliseconds flushInterval = std::chrono::milliseconds(1000));
+    //the flushing thread flushes what is left before it stops
+    ~SaveFile();
+    SaveFile(SaveFile const &) = delete;
+    SaveFile& operator=(SaveFile const &) = delete;
+
+    //created or grown to size, the bytes already saved are kept
+    bool open(std::string const & fileName, size_t size);
+    uint8_t* getData();
+    size_t getSize() const;
+
+    //one atomic or, called after each write to the data
+    void markDirty(size_t offset)
+    {
+        _dirtyPages.fetch_or(uint64_t(1) << (offset / _pageSize), std::memory_order_release);
+    }
+    bool isDirty() const;
+    //syncs the dirty pages on the calling thread
+    void flush();
+    uint64_t getFlushedPages() const;
+
+private:
+
+    void run();
+
+    std::chrono::milliseconds const _flushInterval;
+    std::unique_ptr<MappedFile> _file;
+    //grown until the ram fits in the 64 bits of _dirtyPages
+    size_t _pageSize = 0x1000;
+    std::atomic<uint64_t> _dirtyPages{0};
+    std::atomic<uint64_t> _flushedPages{0};
+
+    std::mutex _mutex;
+    std::condition_variable _wakeUp;
+    bool _isStopping = false;
+    std::thread _flushThread;
+};
+#endif /*SAVEFILE*/
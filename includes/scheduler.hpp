@@ -0,0 +1,63 @@
+#ifndef _SCHEDULER_
+#define _SCHEDULER_
+
+#include <array>
+#include "ischeduler.hpp"
+#include "memory.hpp"
+#include "interupthandler.hpp"
+#include "timer.hpp"
+#include "graphics.hpp"
+
+//Runs the timer, graphics and interrupts only when the master clock
+//reaches their next deadline, or when a write woke them, instead of
+//after every instruction. The state is the same as updating them all
+//after every instruction: a component is left alone only while its
+//update would just count cycles down.
+//With three events the deadlines sit in a fixed table and the earliest
+//one is cached, which keeps the per instruction check to one compare.
+template <class MEMORY>
+class BasicScheduler : public IScheduler
+{
+public:
+
+    BasicScheduler(Memory& memory,
+                   BasicInterruptHandler<MEMORY>& interruptHandler,
+                   BasicTimer<MEMORY>& timer,
+                   BasicGraphics<MEMORY>& graphics);
+
+    //moves the master clock past an instruction and runs the due components
+    void update(int cycles)
+    {
+        _cycles += cycles;
+        if (_cycles >= _nextDeadline) {
+            runEvents(cycles);
+        }
+    }
+
+    void wake(EVENT event) override;
+    uint64_t getCycles() override;
+    uint64_t getDeadline(EVENT event) const;
+    //all a halted cpu has to wait for
+    int getCyclesToNextEvent() const;
+    //master clock back at 0 for a new game, every component due
+    //on the first instruction, reset them along with it
+    void reset();
+
+private:
+
+    void runEvents(int cycles);
+    bool isDue(EVENT event) const;
+    void schedule(EVENT event, uint64_t deadline);
+
+    BasicInterruptHandler<MEMORY>& _interruptHandler;
+    BasicTimer<MEMORY>& _timer;
+    BasicGraphics<MEMORY>& _graphics;
+
+    uint64_t _cycles = 0;
+    uint64_t _nextDeadline = 0;
+    //everything runs on the first instruction
+    std::array<uint64_t, _eventCount> _deadlines{};
+};
+
+using Scheduler = BasicScheduler<IMemory>;
+#endif /*SCHEDULER*/
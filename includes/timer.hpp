@@ -2,14 +2,19 @@
 #define _TIMER_
 
 #include "itimer.hpp"
+#include "iiohandler.hpp"
+#include "ischeduler.hpp"
 #include "imemory.hpp"
 #include "iinterupthandler.hpp"
 
-class Timer : public ITimer
+template <class MEMORY>
+class BasicTimer : public ITimer, public IIoHandler
 {
 public:
 
-    Timer(IMemory& memory, IInterruptHandler& interruptHandler);
+    //registered for the divider and the controler until destroyed
+    BasicTimer(MEMORY& memory, IInterruptHandler& interruptHandler);
+    ~BasicTimer();
 
     // void turnOn() override;
     // void turnOff() override;
@@ -18,10 +23,35 @@ public:
     uint32_t getClockFrequency() override;
     int setClockFrequency() override;
 
+    //the divider then follows the master clock instead of update
+    void setScheduler(IScheduler* scheduler);
+    //driven by the scheduler instead of update, cycles is the master
+    //clock at the instruction boundary, returns the next deadline
+    uint64_t tickCounter(uint64_t cycles);
+    //counts the cycles up to now with the current timer controler,
+    //before it gets written
+    void sync(uint64_t cycles);
+    //the divider counts the cycles since its latest reset, 256 a tick
+    uint8_t readIo(uint16_t adress, uint8_t value) override;
+    //any write resets the divider, a new frequency restarts the count
+    uint8_t writeIo(uint16_t adress, uint8_t data, uint8_t value) override;
+    //for a new game, with the master clock back at 0
+    void reset();
+
 private:
 
-    void doDividerRegister(int cycles);
-    IMemory& _memory;
+    uint64_t getClock() const;
+    void incrementCounter();
+    MEMORY& _memory;
     IInterruptHandler& _interruptHandler;
+    IScheduler* _scheduler = nullptr;
+
+    //cycles given to update, the clock without a scheduler
+    uint64_t _clock = 0;
+    uint64_t _dividerResetCycles = 0;
+    uint64_t _syncCycles = 0;
+    bool _isCounting = false;
 };
+
+using Timer = BasicTimer<IMemory>;
 #endif /*TIMER*/
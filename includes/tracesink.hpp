@@ -0,0 +1,48 @@
+#ifndef _TRACESINK_
+#define _TRACESINK_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "registers.hpp"
+
+//Binary instruction trace: one fixed size record per instruction,
+//written to the file in large chunks. Meant to be diffed or replayed
+//offline, the text log is far too slow for millions of instructions.
+class TraceSink
+{
+public:
+
+    //registers before the instruction runs
+    struct Record
+    {
+        Registers registers;
+        uint8_t opCode;
+        uint8_t unused;
+    };
+
+    TraceSink(std::string const & fileName);
+    ~TraceSink();
+
+    bool isOpen() const;
+    void record(Registers const & registers, uint8_t opCode)
+    {
+        _buffer[_used++] = {registers, opCode, 0};
+        if (_used == _buffer.size()) {
+            flush();
+        }
+    }
+    void flush();
+    uint64_t getRecordCount() const;
+
+    static size_t const _bufferSize = 0x4000;
+
+private:
+
+    std::ofstream _file;
+    std::vector<Record> _buffer;
+    size_t _used = 0;
+    uint64_t _recordCount = 0;
+};
+#endif /*TRACESINK*/
@@ -0,0 +1,272 @@
+#include <algorithm>
+#include "blockcache.hpp"
+
+BlockCache::BlockCache(Memory& memory, IInterruptHandler& interruptHandler)
+    :_memory(memory),
+     _registers(memory.getRegisters()),
+     _interpreter(memory, interruptHandler),
+     _blocks(0x10000)
+{
+    _memory.setCodeCache(this);
+}
+
+BlockCache::~BlockCache()
+{
+    _memory.setCodeCache(nullptr);
+}
+
+int BlockCache::doInstruction(uint8_t opCode)
+{
+    return _interpreter.doInstruction(opCode);
+}
+
+int BlockCache::run()
+{
+    Block* block = findBlock(_registers.pc);
+    if (block == nullptr) {
+        int cycles = _interpreter.doInstruction(_memory.readInMemory(_registers.pc));
+        _scheduler->update(cycles);
+        return cycles;
+    }
+    return runBlock(*block);
+}
+
+//left as soon as PC does not follow the block,
+//after a taken branch or an interrupt
+int BlockCache::runBlock(Block const & block)
+{
+    _runningBlock = &block;
+    _isRunningBlockRemoved = false;
+    MicroOp const * microOps = block.microOps.data();
+    size_t const length = block.microOps.size();
+    int runCycles = 0;
+    for (size_t index = 0; index < length && !_isRunningBlockRemoved;) {
+        MicroOp const & microOp = microOps[index];
+        size_t instructions = 1;
+        if (microOp.fusion != FUSION::NONE && isFusable(&microOp)) {
+            instructions = microOp.fusedLength;
+        }
+        MicroOp const & last = microOps[index + instructions - 1];
+        uint16_t nextPc = last.pc + Interpreter::getInstructionLength(last.opCode);
+        int cycles = instructions == 1
+            ? _interpreter.execute(microOp.opCode, microOp.operand)
+            : runFused(&microOp);
+        index += instructions;
+        _stats.instructions += instructions;
+        runCycles += cycles;
+        _scheduler->update(cycles);
+        if (_registers.pc != nextPc) {
+            break;
+        }
+    }
+    _runningBlock = nullptr;
+    return runCycles;
+}
+
+//no event in the way: the components would only count the cycles
+//between these instructions, and none of them but the last writes
+bool BlockCache::isFusable(MicroOp const * microOps) const
+{
+    if (_isProfiling || _scheduler->getCyclesToNextEvent() <= microOps[0].fusedCycles) {
+        return false;
+    }
+    //a store to the IO registers may wake a component
+    if (microOps[0].fusion == FUSION::COPY_BYTE) {
+        return (microOps[1].opCode == 0x12 ? _registers.de : _registers.bc) < 0xff00;
+    }
+    return true;
+}
+
+int BlockCache::runFused(MicroOp const * fused)
+{
+    //copied, the store may remove the block
+    MicroOp microOps[3];
+    std::copy_n(fused, fused[0].fusedLength, microOps);
+    _stats.fusedRuns++;
+    switch (microOps[0].fusion) {
+    case FUSION::ALU_JUMP_RELATIVE:
+        return _interpreter.aluJumpRelative(microOps[0].opCode, microOps[0].operand,
+                                            microOps[1].opCode, microOps[1].operand);
+    case FUSION::COPY_BYTE:
+        return _interpreter.copyByte(microOps[0].opCode, microOps[1].opCode);
+    case FUSION::LOAD_COMPARE:
+        return _interpreter.loadCompare(microOps[0].operand, microOps[1].operand);
+    default:
+        return _interpreter.loadCompareJump(microOps[0].operand, microOps[1].operand,
+                                            microOps[2].opCode, microOps[2].operand);
+    }
+}
+
+void BlockCache::setProfiler(Profiler* profiler)
+{
+    _interpreter.setProfiler(profiler);
+    _isProfiling = profiler != nullptr;
+}
+
+void BlockCache::setScheduler(BasicScheduler<Memory>* scheduler)
+{
+    _scheduler = scheduler;
+}
+
+void BlockCache::invalidate(uint16_t adress)
+{
+    int firstPc = std::max(0, adress - _maxBlockSize + 1);
+    for (int startPc = firstPc; startPc <= adress; startPc++) {
+        Block* block = _blocks[startPc].get();
+        if (block != nullptr && adress < startPc + block->size) {
+            removeBlock(startPc);
+            _stats.invalidations++;
+        }
+    }
+}
+
+void BlockCache::clear()
+{
+    for (auto& block : _blocks) {
+        block.reset();
+    }
+    _codeMap.fill(0);
+    _isRunningBlockRemoved = _runningBlock != nullptr;
+    _stats.blocks = 0;
+}
+
+BlockCache::Stats const & BlockCache::getStats() const
+{
+    return _stats;
+}
+
+BlockCache::Block* BlockCache::findBlock(uint16_t pc)
+{
+    if (pc >= _cacheableEnd) {
+        return nullptr;
+    }
+    _stats.lookups++;
+    if (_blocks[pc] != nullptr) {
+        _stats.hits++;
+        return _blocks[pc].get();
+    }
+    std::unique_ptr<Block> decoded = decodeBlock(pc);
+    if (decoded->microOps.empty()) {
+        return nullptr;
+    }
+    _blocks[pc] = std::move(decoded);
+    Block const & block = *_blocks[pc];
+    for (int adress = pc; adress < pc + block.size; adress++) {
+        _codeMap[adress]++;
+    }
+    _stats.blocks++;
+    return _blocks[pc].get();
+}
+
+std::unique_ptr<BlockCache::Block> BlockCache::decodeBlock(uint16_t pc)
+{
+    std::unique_ptr<Block> block(new Block{pc, 0, {}});
+    int cursor = pc;
+    while (true) {
+        uint8_t opCode = _memory.readInMemory(cursor);
+        uint8_t length = Interpreter::getInstructionLength(opCode);
+        if (cursor + length > _cacheableEnd || cursor + length - pc > _maxBlockSize) {
+            break;
+        }
+        uint16_t operand = 0;
+        if (length > 1) {
+            operand = _memory.readInMemory(cursor + 1);
+        }
+        if (length > 2) {
+            operand |= static_cast<uint16_t>(_memory.readInMemory(cursor + 2)) << 8;
+        }
+        block->microOps.push_back({static_cast<uint16_t>(cursor), operand, opCode, FUSION::NONE, 0, 0});
+        cursor += length;
+        if (isEndOfBlock(opCode)) {
+            break;
+        }
+    }
+    block->size = cursor - pc;
+    fuse(block->microOps);
+    return block;
+}
+
+namespace
+{
+    //8 bit ALU on A, INC/DEC r, they neither write nor wake anything
+    int getAluCycles(uint8_t opCode)
+    {
+        if (opCode >= 0x80 && opCode <= 0xBF) {
+            return (opCode & 0x07) == 0x06 ? 8 : 4;
+        }
+        switch (opCode) {
+        case 0xC6: case 0xCE: case 0xD6: case 0xDE: case 0xE6: case 0xEE: case 0xF6: case 0xFE:
+            return 8;
+        case 0x04: case 0x05: case 0x0C: case 0x0D: case 0x14: case 0x15:
+        case 0x1C: case 0x1D: case 0x24: case 0x25: case 0x2C: case 0x2D: case 0x3C: case 0x3D:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+
+    bool isJumpRelativeIf(uint8_t opCode)
+    {
+        return opCode == 0x20 || opCode == 0x28 || opCode == 0x30 || opCode == 0x38;
+    }
+}
+
+void BlockCache::fuse(std::vector<MicroOp>& microOps)
+{
+    for (size_t index = 0; index + 1 < microOps.size(); index++) {
+        MicroOp& microOp = microOps[index];
+        uint8_t opCode = microOp.opCode;
+        uint8_t nextOpCode = microOps[index + 1].opCode;
+        if (opCode == 0xF0 && nextOpCode == 0xFE) {
+            if (index + 2 < microOps.size() && isJumpRelativeIf(microOps[index + 2].opCode)) {
+                microOp.fusion = FUSION::LOAD_COMPARE_JUMP;
+                microOp.fusedLength = 3;
+                microOp.fusedCycles = 32;
+            }
+            else {
+                microOp.fusion = FUSION::LOAD_COMPARE;
+                microOp.fusedLength = 2;
+                microOp.fusedCycles = 20;
+            }
+        }
+        else if ((opCode == 0x2A || opCode == 0x3A) && (nextOpCode == 0x12 || nextOpCode == 0x02)) {
+            microOp.fusion = FUSION::COPY_BYTE;
+            microOp.fusedLength = 2;
+            microOp.fusedCycles = 16;
+        }
+        else if (getAluCycles(opCode) != 0 && isJumpRelativeIf(nextOpCode)) {
+            microOp.fusion = FUSION::ALU_JUMP_RELATIVE;
+            microOp.fusedLength = 2;
+            microOp.fusedCycles = getAluCycles(opCode) + 12;
+        }
+    }
+}
+
+void BlockCache::removeBlock(uint16_t startPc)
+{
+    Block* block = _blocks[startPc].get();
+    for (int adress = startPc; adress < startPc + block->size; adress++) {
+        _codeMap[adress]--;
+    }
+    if (block == _runningBlock) {
+        _isRunningBlockRemoved = true;
+    }
+    _blocks[startPc].reset();
+    _stats.blocks--;
+}
+
+//anything that may not fall through to the next instruction
+bool BlockCache::isEndOfBlock(uint8_t opCode)
+{
+    switch (opCode) {
+    case 0x10: case 0x76:
+    case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+    case 0xC2: case 0xC3: case 0xCA: case 0xD2: case 0xDA: case 0xE9:
+    case 0xC4: case 0xCC: case 0xCD: case 0xD4: case 0xDC:
+    case 0xC0: case 0xC8: case 0xC9: case 0xD0: case 0xD8: case 0xD9:
+    case 0xC7: case 0xCF: case 0xD7: case 0xDF: case 0xE7: case 0xEF: case 0xF7: case 0xFF:
+        return true;
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,40 @@
+#include "cartridgedata.hpp"
+
+CartridgeData::CartridgeData(std::vector<uint8_t> bytes)
+{
+    std::shared_ptr<std::vector<uint8_t> const> owned =
+        std::make_shared<std::vector<uint8_t> const>(std::move(bytes));
+    _data = owned->data();
+    _size = owned->size();
+    _owner = std::move(owned);
+}
+
+CartridgeData::CartridgeData(std::shared_ptr<void const> owner, uint8_t const * data, size_t size)
+    :_owner(std::move(owner)),
+     _data(data),
+     _size(size){}
+
+uint8_t const * CartridgeData::data() const
+{
+    return _data;
+}
+
+size_t CartridgeData::size() const
+{
+    return _size;
+}
+
+bool CartridgeData::empty() const
+{
+    return _size == 0;
+}
+
+uint8_t const * CartridgeData::begin() const
+{
+    return _data;
+}
+
+uint8_t const * CartridgeData::end() const
+{
+    return _data + _size;
+}
@@ -1,16 +1,34 @@
+#include <algorithm>
 #include <iostream>
 #include "cpu.hpp"
 #include <cstring>
 
-Cpu::Cpu(IRomLoader& romLoader)
+Cpu::Cpu(IRomLoader& romLoader, CORE core)
     :_romLoader(romLoader),
      _interruptHandler(_memory),
      _timer(_memory, _interruptHandler),
-     _instructionHandler(_memory, _interruptHandler),
-     _graphics(_memory, _interruptHandler)
-     // _renderer(_graphics.getScreenData())
+     _graphics(_memory, _interruptHandler),
+     _scheduler(_memory, _interruptHandler, _timer, _graphics),
+     _idleLoop(_memory, _scheduler)
 {
-    _memory.setTimer(&_timer);
+    if (core == CORE::INTERPRETER) {
+        _instructionHandler.reset(new Interpreter(_memory, _interruptHandler));
+    }
+    else if (core == CORE::BLOCK_CACHE) {
+        _blockCache = new BlockCache(_memory, _interruptHandler);
+        _blockCache->setScheduler(&_scheduler);
+        _instructionHandler.reset(_blockCache);
+    }
+    else if (core == CORE::JIT) {
+        _jit = new Jit(_memory, _interruptHandler);
+        _jit->setScheduler(&_scheduler);
+        _blockCache = _jit;
+        _instructionHandler.reset(_jit);
+    }
+    else {
+        _memory.setLazyFlags(true);
+        _instructionHandler.reset(new BasicInstructionHandler<Memory>(_memory, _interruptHandler));
+    }
 }
 
 int Cpu::getCurrentCycles()
@@ -18,52 +36,179 @@ int Cpu::getCurrentCycles()
     return _cycles;
 }
 
+void Cpu::setFrameObserver(IFrameObserver* observer)
+{
+    _frameObserver = observer;
+}
+
+void Cpu::setProfiler(Profiler* profiler)
+{
+    _instructionHandler->setProfiler(profiler);
+}
+
+void Cpu::setJitEnabled(bool isEnabled)
+{
+    if (_jit != nullptr) {
+        _jit->setEnabled(isEnabled);
+    }
+}
+
+bool Cpu::startTrace(std::string const & fileName)
+{
+    _traceSink.reset(new TraceSink(fileName));
+    if (!_traceSink->isOpen()) {
+        _traceSink.reset();
+        return false;
+    }
+    return true;
+}
+
+void Cpu::stopTrace()
+{
+    _traceSink.reset();
+}
+
+IdleLoopDetector::Stats const & Cpu::getIdleLoopStats() const
+{
+    return _idleLoop.getStats();
+}
+
+bool Cpu::isLocked() const
+{
+    return _interruptHandler.isLocked();
+}
+
+IInterruptHandler::Fault const & Cpu::getFault() const
+{
+    return _interruptHandler.getFault();
+}
+
 IMemory::State Cpu::getState()
 {
     return _memory.getState();
 }
 
+IMemory::RegisterState Cpu::getRegisterState()
+{
+    return _memory.getRegisterState();
+}
+
+void Cpu::copyMemory(IMemory::RomData& snapshot)
+{
+    _memory.copyMemory(snapshot);
+}
+
 
 void Cpu::nextStep()
 {
-    //For debug
-    // _gameLoaded = false;
-    //For debug
+    _cycles += step(_maxCycles - _cycles);
+}
+
+int Cpu::step(int cyclesLeft)
+{
+    //after HALT and STOP, only the events run until one requests an interrupt,
+    //after an illegal opCode they run until the game is stopped
+    if (_interruptHandler.isHalted()) {
+        //whole instructions, an update of 0 would run the due events twice
+        int cycles = std::max(4, (_scheduler.getCyclesToNextEvent() + 3) / 4 * 4);
+        _scheduler.update(cycles);
+        return cycles;
+    }
     uint16_t pcValue = _memory.get16BitRegister(IMemory::REG16BIT::PC);
     uint8_t opCode = _memory.readInMemory(pcValue);
-    _readableInstructionStream.str({}); // reset
-    _readableInstructionStream <<  "[" << std::hex << 
-        static_cast<int>(opCode) << "] ";
-    BOOST_LOG_TRIVIAL(debug) << "[" << std::hex << static_cast<int>(opCode) << "]";
-    if (opCode == 0x10 || opCode == 0x76) {
-        _gameLoaded = false;
-        return ;
+    GB_LOG(debug) << "[" << std::hex << static_cast<int>(opCode) << "]";
+    if (_traceSink != nullptr) {
+        _traceSink->record(_memory.getRegisters(), opCode);
     }
-    try {
-        int cycles = _instructionHandler.doInstruction(opCode);
-        _cycles += cycles;
-        _timer.update(cycles);
-        //TODO
-        _graphics.update(cycles);
-        _interruptHandler.doInterrupt();
+    int cycles = 0;
+    //the block cache and the JIT run a whole block and update the components themselves
+    if (_blockCache != nullptr) {
+        cycles = _blockCache->run();
     }
-    catch (...) {
-        std::cout << "error catch\n";
+    else {
+        cycles = _instructionHandler->doInstruction(opCode);
+        _scheduler.update(cycles);
+    }
+    //only a backward branch can close a polling loop, PC is read without
+    //computing the lazy flags
+    if (_memory.get16BitRegister(IMemory::REG16BIT::PC) <= pcValue) {
+        cycles += _idleLoop.skip(pcValue, cyclesLeft - cycles);
+    }
+    return cycles;
+}
+
+Cpu::RUN_STATUS Cpu::runCycles(int cycles)
+{
+    return run(cycles, false);
+}
+
+Cpu::RUN_STATUS Cpu::runFrame()
+{
+    return run(0, true);
+}
+
+Cpu::RUN_STATUS Cpu::run(int cycles, bool isFrame)
+{
+    if (!_gameLoaded) {
+        return RUN_STATUS::NO_GAME;
     }
+    bool const wasLocked = _interruptHandler.isLocked();
+    RUN_STATUS status = RUN_STATUS::CYCLES_DONE;
+    int cyclesRun = 0;
+    bool isFirstStep = true;
+    while (isFrame ? status != RUN_STATUS::FRAME_COMPLETE : cyclesRun < cycles) {
+        if (!isFirstStep && !_breakpoints.empty() && !_interruptHandler.isHalted()
+            && _breakpoints.count(_memory.get16BitRegister(IMemory::REG16BIT::PC)) != 0) {
+            return RUN_STATUS::BREAKPOINT;
+        }
+        isFirstStep = false;
+        int cyclesLeft = _maxCycles - _cycles;
+        if (!isFrame) {
+            cyclesLeft = std::min(cyclesLeft, cycles - cyclesRun);
+        }
+        int stepCycles = step(cyclesLeft);
+        cyclesRun += stepCycles;
+        _cycles += stepCycles;
+        if (!(_cycles < _maxCycles)) {
+            _cycles -= _maxCycles;
+            status = RUN_STATUS::FRAME_COMPLETE;
+        }
+        if (!wasLocked && _interruptHandler.isLocked()) {
+            return RUN_STATUS::FAULT;
+        }
+    }
+    return status;
+}
+
+void Cpu::addBreakpoint(uint16_t pc)
+{
+    _breakpoints.insert(pc);
+}
+
+void Cpu::removeBreakpoint(uint16_t pc)
+{
+    _breakpoints.erase(pc);
 }
 
 std::string Cpu::getReadableInstruction()
 {
-    // _readableInstructionStream <<  "[" << std::hex << 
-    //     static_cast<int>(memory.getCurrentOpCode()) << "] ";
-    _readableInstructionStream << _instructionHandler.getReadableInstruction();
-    return _readableInstructionStream.str();
+    if (!_hasDebugInstruction) {
+        return {};
+    }
+    return Disassembler::getHistoryLine(_debugBytes, _debugFlags);
 }
 
 void Cpu::updateDebug()
 {
     if (_gameLoaded) {
         if (_cycles < _maxCycles) {
+            //only the bytes are kept, the text is built if the debugger asks
+            uint16_t pcValue = _memory.get16BitRegister(IMemory::REG16BIT::PC);
+            _debugBytes = {_memory.readInMemory(pcValue),
+                           _memory.readInMemory(pcValue + 1),
+                           _memory.readInMemory(pcValue + 2)};
+            _debugFlags = _memory.get8BitRegister(IMemory::REG8BIT::F);
+            _hasDebugInstruction = true;
             nextStep();
         }
         if (!(_cycles < _maxCycles)) {
@@ -75,46 +220,58 @@ void Cpu::updateDebug()
 void Cpu::update()
 {
     while (_gameLoaded) {
-        while (_gameLoaded &&_cycles < _maxCycles) {
-            nextStep();
-        }
-        //TODO
-        //render sfml
-        auto screen = _graphics.getScreenData();
-        for (int y = 0; y < 144; y++) {
-            for (int x = 0; x < 160; x++) {
-                _screenBuffer[y][x][0] =  screen[y][x]._red;
-                _screenBuffer[y][x][1] =  screen[y][x]._green;
-                _screenBuffer[y][x][2] =  screen[y][x]._blue;
-                _screenBuffer[y][x][3] = 1;
-            }
+        runFrame();
+        if (_frameObserver != nullptr) {
+            _frameObserver->frameCompleted(_graphics.getScreenData());
         }
-        emit screen_refresh();
-        _cycles -= _maxCycles;
     }
 }
 
-bool Cpu::launchGameDebug(std::string const & cartridgeName)
+bool Cpu::loadGame(std::string const & cartridgeName)
 {
     if (_romLoader.load(cartridgeName)
         && _memory.setCartridge(_romLoader.getData())) {
+        loadSaveFile(cartridgeName);
+        //the blocks and the native code went with the former cartridge
+        _interruptHandler.reset();
+        _timer.reset();
+        _graphics.reset();
+        _scheduler.reset();
+        _idleLoop.resetStats();
+        _cycles = 0;
+        _hasDebugInstruction = false;
         _gameLoaded = true;
         return true;
     }
     return false;
 }
 
-bool Cpu::launchGame(std::string const & cartridgeName)
+//the game still runs on the ram in memory when the file can not be opened
+void Cpu::loadSaveFile(std::string const & cartridgeName)
 {
-    if (_romLoader.load(cartridgeName)
-        && _memory.setCartridge(_romLoader.getData())) {
-            _gameLoaded = true;
-            update();
+    size_t size = _memory.getBatteryRamSize();
+    if (size == 0) {
+        return;
     }
-    else {
+    std::shared_ptr<SaveFile> saveFile(new SaveFile);
+    if (!saveFile->open(SaveFile::getPath(cartridgeName), size)
+        || !_memory.setSaveFile(std::move(saveFile))) {
+        std::cout << "error opening save file, the game will not be saved\n";
+    }
+}
+
+bool Cpu::launchGameDebug(std::string const & cartridgeName)
+{
+    return loadGame(cartridgeName);
+}
+
+bool Cpu::launchGame(std::string const & cartridgeName)
+{
+    if (!loadGame(cartridgeName)) {
         std::cout << "error loading cartridge\n";
         return false;
     }
+    update();
     return true;
 }
 
@@ -122,4 +279,3 @@ void Cpu::stopGame()
 {
     _gameLoaded = false;
 }
-
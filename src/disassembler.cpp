@@ -0,0 +1,315 @@
+#include <map>
+#include <sstream>
+#include "disassembler.hpp"
+
+std::array<Disassembler::Mnemonic, 0x100> const & Disassembler::getTable()
+{
+    //illegal opCodes have no text
+    static std::map<uint8_t, Mnemonic> const mnemonics =
+        {
+            {0x00, {"nop"}},
+            {0x01, {"ld BC,%w"}},
+            {0x02, {"ld (BC),A"}},
+            {0x03, {"inc BC"}},
+            {0x04, {"inc B"}},
+            {0x05, {"dec B"}},
+            {0x06, {"ld B,%n"}},
+            {0x07, {"rlca"}},
+            {0x08, {"ld $%w, SP"}},
+            {0x09, {"add hl,BC"}},
+            {0x0A, {"ld A,(BC)"}},
+            {0x0B, {"dec BC"}},
+            {0x0C, {"inc C"}},
+            {0x0D, {"dec C"}},
+            {0x0E, {"ld C,%n"}},
+            {0x0F, {"rrca"}},
+            {0x10, {"stop"}},
+            {0x11, {"ld DE,%w"}},
+            {0x12, {"ld (DE),A"}},
+            {0x13, {"inc DE"}},
+            {0x14, {"inc D"}},
+            {0x15, {"dec D"}},
+            {0x16, {"ld D,%n"}},
+            {0x17, {"rla"}},
+            {0x18, {"jr %e"}},
+            {0x19, {"add hl,DE"}},
+            {0x1A, {"ld A,(DE)"}},
+            {0x1B, {"dec DE"}},
+            {0x1C, {"inc E"}},
+            {0x1D, {"dec E"}},
+            {0x1E, {"ld E,%n"}},
+            {0x1F, {"rra"}},
+            {0x20, {"jr nZ,$%e", IMemory::FLAG::Z, false}},
+            {0x21, {"ld HL,%w"}},
+            {0x22, {"ld (HL+),A"}},
+            {0x23, {"inc HL"}},
+            {0x24, {"inc H"}},
+            {0x25, {"dec H"}},
+            {0x26, {"ld H,%n"}},
+            {0x27, {"daa"}},
+            {0x28, {"jr Z,$%e", IMemory::FLAG::Z, true}},
+            {0x29, {"add hl,HL"}},
+            {0x2A, {"ld A,(HL+)"}},
+            {0x2B, {"dec HL"}},
+            {0x2C, {"inc L"}},
+            {0x2D, {"dec L"}},
+            {0x2E, {"ld L,%n"}},
+            {0x2F, {"cpl"}},
+            {0x30, {"jr nC,$%e", IMemory::FLAG::C, false}},
+            {0x31, {"ld SP,%w"}},
+            {0x32, {"ld (HL-),A"}},
+            {0x33, {"inc SP"}},
+            {0x34, {"inc (HL)"}},
+            {0x35, {"dec (HL)"}},
+            {0x36, {"ld (HL), %n"}},
+            {0x37, {"scf"}},
+            {0x38, {"jr C,$%e", IMemory::FLAG::C, true}},
+            {0x39, {"add hl,SP"}},
+            {0x3A, {"ld A,(HL-)"}},
+            {0x3B, {"dec SP"}},
+            {0x3C, {"inc A"}},
+            {0x3D, {"dec A"}},
+            {0x3E, {"ld A,%n"}},
+            {0x3F, {"ccf"}},
+            {0x40, {"ld B, B"}},
+            {0x41, {"ld B, C"}},
+            {0x42, {"ld B, D"}},
+            {0x43, {"ld B, E"}},
+            {0x44, {"ld B, H"}},
+            {0x45, {"ld B, L"}},
+            {0x46, {"ld B,(HL)"}},
+            {0x47, {"ld B, A"}},
+            {0x48, {"ld C, B"}},
+            {0x49, {"ld C, C"}},
+            {0x4A, {"ld C, D"}},
+            {0x4B, {"ld C, E"}},
+            {0x4C, {"ld C, H"}},
+            {0x4D, {"ld C, L"}},
+            {0x4E, {"ld C,(HL)"}},
+            {0x4F, {"ld C, A"}},
+            {0x50, {"ld D, B"}},
+            {0x51, {"ld D, C"}},
+            {0x52, {"ld D, D"}},
+            {0x53, {"ld D, E"}},
+            {0x54, {"ld D, H"}},
+            {0x55, {"ld D, L"}},
+            {0x56, {"ld D,(HL)"}},
+            {0x57, {"ld D, A"}},
+            {0x58, {"ld E, B"}},
+            {0x59, {"ld E, C"}},
+            {0x5A, {"ld E, D"}},
+            {0x5B, {"ld E, E"}},
+            {0x5C, {"ld E, H"}},
+            {0x5D, {"ld E, L"}},
+            {0x5E, {"ld E,(HL)"}},
+            {0x5F, {"ld E, A"}},
+            {0x60, {"ld H, B"}},
+            {0x61, {"ld H, C"}},
+            {0x62, {"ld H, D"}},
+            {0x63, {"ld H, E"}},
+            {0x64, {"ld H, H"}},
+            {0x65, {"ld H, L"}},
+            {0x66, {"ld H,(HL)"}},
+            {0x67, {"ld H, A"}},
+            {0x68, {"ld L, B"}},
+            {0x69, {"ld L, C"}},
+            {0x6A, {"ld L, D"}},
+            {0x6B, {"ld L, E"}},
+            {0x6C, {"ld L, H"}},
+            {0x6D, {"ld L, L"}},
+            {0x6E, {"ld L,(HL)"}},
+            {0x6F, {"ld L, A"}},
+            {0x70, {"ld (HL),B"}},
+            {0x71, {"ld (HL),C"}},
+            {0x72, {"ld (HL),D"}},
+            {0x73, {"ld (HL),E"}},
+            {0x74, {"ld (HL),H"}},
+            {0x75, {"ld (HL),L"}},
+            {0x76, {"halt"}},
+            {0x77, {"ld (HL),A"}},
+            {0x78, {"ld A, B"}},
+            {0x79, {"ld A, C"}},
+            {0x7A, {"ld A, D"}},
+            {0x7B, {"ld A, E"}},
+            {0x7C, {"ld A, H"}},
+            {0x7D, {"ld A, L"}},
+            {0x7E, {"ld A,(HL)"}},
+            {0x7F, {"ld A, A"}},
+            {0x80, {"add a,B"}},
+            {0x81, {"add a,C"}},
+            {0x82, {"add a,D"}},
+            {0x83, {"add a,E"}},
+            {0x84, {"add a,H"}},
+            {0x85, {"add a,L"}},
+            {0x86, {"add a,(hl)"}},
+            {0x87, {"add a,A"}},
+            {0x88, {"adc a,B"}},
+            {0x89, {"adc a,C"}},
+            {0x8A, {"adc a,D"}},
+            {0x8B, {"adc a,E"}},
+            {0x8C, {"adc a,H"}},
+            {0x8D, {"adc a,L"}},
+            {0x8E, {"adc a,(hl)"}},
+            {0x8F, {"adc a,A"}},
+            {0x90, {"sub B"}},
+            {0x91, {"sub C"}},
+            {0x92, {"sub D"}},
+            {0x93, {"sub E"}},
+            {0x94, {"sub H"}},
+            {0x95, {"sub L"}},
+            {0x96, {"sub (hl)"}},
+            {0x97, {"sub A"}},
+            {0x98, {"sbc a,B"}},
+            {0x99, {"sbc a,C"}},
+            {0x9A, {"sbc a,D"}},
+            {0x9B, {"sbc a,E"}},
+            {0x9C, {"sbc a,H"}},
+            {0x9D, {"sbc a,L"}},
+            {0x9E, {"sbc a,(hl)"}},
+            {0x9F, {"sbc a,A"}},
+            {0xA0, {"and B"}},
+            {0xA1, {"and C"}},
+            {0xA2, {"and D"}},
+            {0xA3, {"and E"}},
+            {0xA4, {"and H"}},
+            {0xA5, {"and L"}},
+            {0xA6, {"and (HL)"}},
+            {0xA7, {"and A"}},
+            {0xA8, {"xor B"}},
+            {0xA9, {"xor C"}},
+            {0xAA, {"xor D"}},
+            {0xAB, {"xor E"}},
+            {0xAC, {"xor H"}},
+            {0xAD, {"xor L"}},
+            {0xAE, {"xor (HL)"}},
+            {0xAF, {"xor A"}},
+            {0xB0, {"or B"}},
+            {0xB1, {"or C"}},
+            {0xB2, {"or D"}},
+            {0xB3, {"or E"}},
+            {0xB4, {"or H"}},
+            {0xB5, {"or L"}},
+            {0xB6, {"or (HL)"}},
+            {0xB7, {"or A"}},
+            {0xB8, {"cp B"}},
+            {0xB9, {"cp C"}},
+            {0xBA, {"cp D"}},
+            {0xBB, {"cp E"}},
+            {0xBC, {"cp H"}},
+            {0xBD, {"cp L"}},
+            {0xBE, {"cp (hl)"}},
+            {0xBF, {"cp A"}},
+            {0xC0, {"ret Z"}},
+            {0xC1, {"pop BC"}},
+            {0xC2, {"jp nZ,$%w", IMemory::FLAG::Z, false}},
+            {0xC3, {"jp $%w"}},
+            {0xC4, {"call nZ,$%w", IMemory::FLAG::Z, false}},
+            {0xC5, {"push BC"}},
+            {0xC6, {"add a,$%n"}},
+            {0xC7, {"rst0h"}},
+            {0xC8, {"ret Z"}},
+            {0xC9, {"ret"}},
+            {0xCA, {"jp Z,$%w", IMemory::FLAG::Z, true}},
+            {0xCB, {"cb"}},
+            {0xCC, {"call Z,$%w", IMemory::FLAG::Z, true}},
+            {0xCD, {"call $%w"}},
+            {0xCE, {"adc a,(%n)"}},
+            {0xCF, {"rst8h"}},
+            {0xD0, {"ret C"}},
+            {0xD1, {"pop DE"}},
+            {0xD2, {"jp nC,$%w", IMemory::FLAG::C, false}},
+            {0xD4, {"call nC,$%w", IMemory::FLAG::C, false}},
+            {0xD5, {"push DE"}},
+            {0xD6, {"sub (%n)"}},
+            {0xD7, {"rst10h"}},
+            {0xD8, {"ret C"}},
+            {0xD9, {"reti"}},
+            {0xDA, {"jp C,$%w", IMemory::FLAG::C, true}},
+            {0xDC, {"call C,$%w", IMemory::FLAG::C, true}},
+            {0xDE, {"sbc a,(%n)"}},
+            {0xDF, {"rst18h"}},
+            {0xE0, {"ldh (%n),A"}},
+            {0xE1, {"pop HL"}},
+            {0xE2, {"ldh (C),A"}},
+            {0xE5, {"push HL"}},
+            {0xE6, {"and $%n"}},
+            {0xE7, {"rst20h"}},
+            {0xE8, {"add sp,$%n"}},
+            {0xE9, {"jp (hl)"}},
+            {0xEA, {"ld $%w,A"}},
+            {0xEE, {"xor $%n"}},
+            {0xEF, {"rst28h"}},
+            {0xF0, {"ldh A,(%n)"}},
+            {0xF1, {"pop AF"}},
+            {0xF2, {"ldh A,(C)"}},
+            {0xF3, {"di"}},
+            {0xF5, {"push AF"}},
+            {0xF6, {"or $%n"}},
+            {0xF7, {"rst30h"}},
+            {0xF8, {"ld hl, sp + %e"}},
+            {0xF9, {"ld SP,HL"}},
+            {0xFA, {"ld A,$%w"}},
+            {0xFB, {"ei"}},
+            {0xFE, {"cp (%n)"}},
+            {0xFF, {"rst38h"}}
+        };
+    static std::array<Mnemonic, 0x100> const table = [] {
+        std::array<Mnemonic, 0x100> flatTable;
+        for (auto const & pair : mnemonics) {
+            flatTable[pair.first] = pair.second;
+        }
+        return flatTable;
+    }();
+    return table;
+}
+
+std::string Disassembler::disassemble(Bytes const & bytes, uint8_t flags)
+{
+    Mnemonic const & mnemonic = getTable()[bytes[0]];
+    if (mnemonic.format == nullptr) {
+        return {};
+    }
+    bool isConditionMet = true;
+    if (mnemonic.isConditional) {
+        bool isSet = (flags >> static_cast<int>(mnemonic.flag)) & 0x01;
+        isConditionMet = isSet == mnemonic.isToBeSet;
+    }
+
+    std::stringstream text;
+    for (char const * cursor = mnemonic.format; *cursor != '\0'; cursor++) {
+        if (*cursor != '%') {
+            text << *cursor;
+            continue;
+        }
+        cursor++;
+        if (!isConditionMet) {
+            text << "[condition not met]";
+        }
+        else if (*cursor == 'n') {
+            text << std::hex << static_cast<int>(bytes[1]);
+        }
+        else if (*cursor == 'w') {
+            text << std::hex << ((static_cast<int>(bytes[2]) << 8) | bytes[1]);
+        }
+        else if (*cursor == 'e') {
+            text << std::hex << static_cast<int>(static_cast<int8_t>(bytes[1]));
+        }
+    }
+    return text.str();
+}
+
+std::string Disassembler::disassemble(IMemory& memory, uint16_t pc)
+{
+    Bytes bytes = {memory.readInMemory(pc),
+                   memory.readInMemory(pc + 1),
+                   memory.readInMemory(pc + 2)};
+    return disassemble(bytes, memory.get8BitRegister(IMemory::REG8BIT::F));
+}
+
+std::string Disassembler::getHistoryLine(Bytes const & bytes, uint8_t flags)
+{
+    std::stringstream line;
+    line << "[" << std::hex << static_cast<int>(bytes[0]) << "] "
+         << disassemble(bytes, flags);
+    return line.str();
+}
@@ -28,3 +28,12 @@ void FileIO::closeFile(int fd)
 {
     close(fd);
 }
+
+std::shared_ptr<MappedFile> FileIO::mapFile(int fd)
+{
+    std::shared_ptr<MappedFile> mappedFile(new MappedFile);
+    if (!mappedFile->map(fd)) {
+        return nullptr;
+    }
+    return mappedFile;
+}
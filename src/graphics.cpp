@@ -1,20 +1,48 @@
 #include <cassert>
 #include <iostream>
 #include "graphics.hpp"
+#include "memory.hpp"
 
-Graphics::Graphics(IMemory& memory, IInterruptHandler& interruptHandler)
+template <class MEMORY>
+BasicGraphics<MEMORY>::BasicGraphics(MEMORY& memory, IInterruptHandler& interruptHandler)
     : _screenData(144, {160, {0xff,0xff,0xff}}),
       _memory(memory),
-      _interruptHandler(interruptHandler){};
+      _interruptHandler(interruptHandler)
+{
+    _memory.setIoHandler(_scanlineAdress, this);
+    _memory.setIoHandler(_dmaAdress, this);
+}
+
+template <class MEMORY>
+BasicGraphics<MEMORY>::~BasicGraphics()
+{
+    _memory.setIoHandler(_scanlineAdress, nullptr);
+    _memory.setIoHandler(_dmaAdress, nullptr);
+}
+
+template <class MEMORY>
+uint8_t BasicGraphics<MEMORY>::writeIo(uint16_t adress, uint8_t data, uint8_t value)
+{
+    if (adress == _scanlineAdress) {
+        return 0;
+    }
+    uint16_t source = data << 8;
+    for (int index = 0; index < 0xa0; index++) {
+        _memory.writeInMemory(_memory.readInMemory(source + index), 0xfe00 + index);
+    }
+    return value;
+}
 
 //////////////////////////////////////////////////////////////////
-std::vector<std::vector<RGB>> const & Graphics::getScreenData()
+template <class MEMORY>
+std::vector<std::vector<RGB>> const & BasicGraphics<MEMORY>::getScreenData()
 {
     return _screenData;
 }
 //////////////////////////////////////////////////////////////////
 
-void Graphics::resetScreen()
+template <class MEMORY>
+void BasicGraphics<MEMORY>::resetScreen()
 {
     // TODO duplication might cause issue in the future
     // use screenData and change the value (like _screnData.fill())
@@ -24,7 +52,18 @@ void Graphics::resetScreen()
 
 //////////////////////////////////////////////////////////////////
 
-bool Graphics::isLCDEnabled()
+template <class MEMORY>
+void BasicGraphics<MEMORY>::reset()
+{
+    _scanlineCounter = 0;
+    _tickCycles = 0;
+    resetScreen();
+}
+
+//////////////////////////////////////////////////////////////////
+
+template <class MEMORY>
+bool BasicGraphics<MEMORY>::isLCDEnabled()
 {
     return true; // TODO
     std::bitset<8> lcdControlRegister(_memory.readInMemory(_LCDControlRegister));
@@ -34,7 +73,8 @@ bool Graphics::isLCDEnabled()
 //////////////////////////////////////////////////////////////////
 
 
-uint8_t Graphics::getLCDMode() const
+template <class MEMORY>
+uint8_t BasicGraphics<MEMORY>::getLCDMode() const
 {
     std::bitset<8> lcdStatus(_memory.readInMemory(_LCDStatusAdress));
     std::bitset<8> toAnd(0x03);
@@ -44,7 +84,8 @@ uint8_t Graphics::getLCDMode() const
 
 //////////////////////////////////////////////////////////////////
 
-std::bitset<8> Graphics::getLCDControl()
+template <class MEMORY>
+std::bitset<8> BasicGraphics<MEMORY>::getLCDControl()
 {
     uint8_t lcdControl = _memory.readInMemory(_LCDControlRegister);
     std::bitset<8> bitsetControl(lcdControl);
@@ -53,7 +94,8 @@ std::bitset<8> Graphics::getLCDControl()
 //////////////////////////////////////////////////////////////////
 
 //TODO check if the one on .old isn't better
-void Graphics::update( int cycles )
+template <class MEMORY>
+void BasicGraphics<MEMORY>::update( int cycles )
 {
     setLCDStatus();
 
@@ -73,10 +115,25 @@ void Graphics::update( int cycles )
     }
 }
 
+template <class MEMORY>
+uint64_t BasicGraphics<MEMORY>::tickScanline(uint64_t cycles, int instructionCycles)
+{
+    // the instructions skipped since the latest tick only counted down
+    _scanlineCounter -= static_cast<int>(cycles - instructionCycles - _tickCycles);
+    _tickCycles = cycles;
+    update(instructionCycles);
+
+    if (!isLCDStatusUpToDate()) {
+        return cycles;
+    }
+    return cycles + getCyclesToNextMode();
+}
+
 
 //////////////////////////////////////////////////////////////////
 
-void Graphics::drawScanline()
+template <class MEMORY>
+void BasicGraphics<MEMORY>::drawScanline()
 {
 
     // we can only draw of the LCD is enabled
@@ -88,7 +145,8 @@ void Graphics::drawScanline()
 
 //////////////////////////////////////////////////////////////////
 
-void Graphics::drawCurrentLine()
+template <class MEMORY>
+void BasicGraphics<MEMORY>::drawCurrentLine()
 {
     if (isLCDEnabled()) {
         _memory.incrementScanline();
@@ -111,7 +169,8 @@ void Graphics::drawCurrentLine()
 }
 
 //////////////////////////////////////////////////////////////////
-uint16_t Graphics::getBackgroundMem(bool usingWindow) 
+template <class MEMORY>
+uint16_t BasicGraphics<MEMORY>::getBackgroundMem(bool usingWindow) 
 {
     std::bitset<8> lcdControl(getLCDControl());
     if(!usingWindow) {
@@ -132,7 +191,8 @@ uint16_t Graphics::getBackgroundMem(bool usingWindow)
     }
 }
 //////////////////////////////////////////////////////////////////
-RGB Graphics::getColour(uint8_t colourNum, uint16_t address) const
+template <class MEMORY>
+RGB BasicGraphics<MEMORY>::getColour(uint8_t colourNum, uint16_t address) const
 {
     uint8_t palette = _memory.readInMemory(address);
     std::bitset<8> bitsetPalette(palette);
@@ -164,7 +224,8 @@ RGB Graphics::getColour(uint8_t colourNum, uint16_t address) const
 }
 //////////////////////////////////////////////////////////////////
 
-void Graphics::renderBackground()
+template <class MEMORY>
+void BasicGraphics<MEMORY>::renderBackground()
 {
     // lets draw the background (however it does need to be enabled)
     std::bitset<8> lcdControl(getLCDControl());
@@ -271,7 +332,8 @@ void Graphics::renderBackground()
 
 //////////////////////////////////////////////////////////////////
 
-void Graphics::renderSprites()
+template <class MEMORY>
+void BasicGraphics<MEMORY>::renderSprites()
 {
     // lets draw the sprites (however it does need to be enabled)
     std::bitset<8> lcdControl = getLCDControl();
@@ -394,7 +456,8 @@ void Graphics::renderSprites()
 // }
 
 //////////////////////////////////////////////////////////////////
-void Graphics::setLCDStatus()
+template <class MEMORY>
+void BasicGraphics<MEMORY>::setLCDStatus()
 {
 
     std::bitset<8> lcdStatus(_memory.readInMemory(_LCDStatusAdress));
@@ -409,7 +472,20 @@ void Graphics::setLCDStatus()
         return;
     }
 
+    bool isInterruptRequested = false;
+    lcdStatus = getLCDStatus(isInterruptRequested);
+    if (isInterruptRequested) {
+        _interruptHandler.requestInterrupt(IInterruptHandler::INTERRUPT::LCD);
+    }
+    _memory.writeInMemory(lcdStatus.to_ulong(), _LCDStatusAdress);
+}
+
+//////////////////////////////////////////////////////////////////
 
+template <class MEMORY>
+std::bitset<8> BasicGraphics<MEMORY>::getLCDStatus(bool& isInterruptRequested)
+{
+    std::bitset<8> lcdStatus(_memory.readInMemory(_LCDStatusAdress));
     uint8_t currentLine = _memory.readInMemory(_scanlineAdress);
     uint8_t currentMode = getLCDMode();
 
@@ -451,8 +527,7 @@ void Graphics::setLCDStatus()
     }
 
     // just entered a new mode. Request interupt
-    if (reqInt && (currentMode != mode))
-        _interruptHandler.requestInterrupt(IInterruptHandler::INTERRUPT::LCD);
+    isInterruptRequested = reqInt && (currentMode != mode);
 
     // check for coincidence flag
     uint8_t coincidenceFlag = _memory.readInMemory(_coincidenceAdress);
@@ -460,12 +535,50 @@ void Graphics::setLCDStatus()
         lcdStatus.set(2);
 
         if (lcdStatus.test(6)) {
-            _interruptHandler.requestInterrupt(IInterruptHandler::INTERRUPT::LCD);
+            isInterruptRequested = true;
         }
     }
     else {
         lcdStatus.reset(2);
     }
-    _memory.writeInMemory(lcdStatus.to_ulong(), _LCDStatusAdress);
+    return lcdStatus;
+}
+
+//////////////////////////////////////////////////////////////////
+
+// false when the next setLCDStatus would change the status or request an interrupt
+template <class MEMORY>
+bool BasicGraphics<MEMORY>::isLCDStatusUpToDate()
+{
+    bool isInterruptRequested = false;
+    std::bitset<8> lcdStatus = getLCDStatus(isInterruptRequested);
+    if (lcdStatus.to_ulong() != _memory.readInMemory(_LCDStatusAdress)) {
+        return false;
+    }
+    std::bitset<8> interruptRequest(_memory.readInMemory(_interruptRequest));
+    return !isInterruptRequested
+        || interruptRequest.test(static_cast<int>(IInterruptHandler::INTERRUPT::LCD));
+}
+
+//////////////////////////////////////////////////////////////////
+
+// cycles until the counter crosses a mode bound or ends the line
+template <class MEMORY>
+int BasicGraphics<MEMORY>::getCyclesToNextMode()
+{
+    uint8_t currentLine = _memory.readInMemory(_scanlineAdress);
+    if (currentLine < _verticalBlancScanline) {
+        int mode2Bounds = (_retraceStart - 80);
+        int mode3Bounds = (mode2Bounds - 172);
+        if (_scanlineCounter >= mode2Bounds) {
+            return _scanlineCounter - mode2Bounds + 1;
+        }
+        if (_scanlineCounter >= mode3Bounds) {
+            return _scanlineCounter - mode3Bounds + 1;
+        }
+    }
+    return _scanlineCounter;
 }
 
+template class BasicGraphics<IMemory>;
+template class BasicGraphics<Memory>;
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include "idleloop.hpp"
+
+IdleLoopDetector::IdleLoopDetector(Memory& memory, BasicScheduler<Memory>& scheduler)
+    :_memory(memory),
+     _scheduler(scheduler){}
+
+int IdleLoopDetector::skip(uint16_t lastPc, int maxCycles)
+{
+    Loop loop;
+    if (!decode(_memory.get16BitRegister(IMemory::REG16BIT::PC), lastPc, loop)
+        || maxCycles < loop.iterationCycles
+        || !isSteady(loop)) {
+        return 0;
+    }
+    Registers& registers = _memory.getRegisters();
+    uint8_t polledValue = _memory.readInMemory(loop.polledAdress);
+    int skipped = 0;
+    int index = 0;
+    while (true) {
+        if (index == 0) {
+            //nothing is due before the last of these iterations ends
+            int iterations = std::max(0, _scheduler.getCyclesToNextEvent() - 1) / loop.iterationCycles;
+            iterations = std::min(iterations, (maxCycles - skipped) / loop.iterationCycles);
+            if (iterations > 0) {
+                _scheduler.update(iterations * loop.iterationCycles);
+                skipped += iterations * loop.iterationCycles;
+            }
+            if (skipped + loop.iterationCycles > maxCycles) {
+                break;
+            }
+        }
+        //the events due after this instruction run as if it had
+        uint16_t nextPc = loop.nextPcs[index];
+        registers.pc = nextPc;
+        _scheduler.update(loop.cycles[index]);
+        skipped += loop.cycles[index];
+        index = (index + 1) % loop.length;
+        if (registers.pc != nextPc
+            || (loop.isPolling && _memory.readInMemory(loop.polledAdress) != polledValue)) {
+            break;
+        }
+    }
+    _stats.skippedCycles += skipped;
+    _stats.skips++;
+    return skipped;
+}
+
+IdleLoopDetector::Stats const & IdleLoopDetector::getStats() const
+{
+    return _stats;
+}
+
+void IdleLoopDetector::resetStats()
+{
+    _stats = Stats();
+}
+
+//same cycles as the cores, taken branches only
+bool IdleLoopDetector::decode(uint16_t start, uint16_t lastPc, Loop& loop)
+{
+    uint16_t pc = start;
+    uint8_t opCode = _memory.readInMemory(pc);
+    //the read comes first, so an iteration only depends on the value read
+    if (opCode == 0xF0 && isPolled(0xff00 + _memory.readInMemory(pc + 1))) {
+        loop.polledAdress = 0xff00 + _memory.readInMemory(pc + 1);
+        add(loop, pc, 12, pc + 2);
+    }
+    else if (opCode == 0xFA) {
+        uint16_t adress = _memory.readInMemory(pc + 1) | (_memory.readInMemory(pc + 2) << 8);
+        if (!isPolled(adress)) {
+            return false;
+        }
+        loop.polledAdress = adress;
+        add(loop, pc, 16, pc + 3);
+    }
+    loop.isPolling = loop.length != 0;
+
+    while (loop.length < _maxInstructions) {
+        pc = loop.length == 0 ? start : loop.nextPcs[loop.length - 1];
+        opCode = _memory.readInMemory(pc);
+        uint16_t target = 0;
+        int cycles = 0;
+        switch (opCode) {
+        //cp and and, only A and the flags change
+        case 0xFE: case 0xE6:
+            add(loop, pc, 8, pc + 2);
+            continue;
+        case 0xA7: case 0xB7:
+            add(loop, pc, 4, pc + 1);
+            continue;
+        case 0xCB:
+            //bit b,A
+            if ((_memory.readInMemory(pc + 1) & 0xC7) != 0x47) {
+                return false;
+            }
+            add(loop, pc, 12, pc + 2);
+            continue;
+        case 0x18:
+        case 0x20: case 0x28: case 0x30: case 0x38:
+            target = pc + 2 + static_cast<int8_t>(_memory.readInMemory(pc + 1));
+            cycles = 12;
+            break;
+        case 0xC2: case 0xC3: case 0xCA: case 0xD2: case 0xDA:
+            target = _memory.readInMemory(pc + 1) | (_memory.readInMemory(pc + 2) << 8);
+            cycles = 16;
+            break;
+        default:
+            return false;
+        }
+        //polling, or nothing but the branch
+        if (target != start || (!loop.isPolling && loop.length != 0)) {
+            return false;
+        }
+        add(loop, pc, cycles, start);
+        //the branch back just ran, or the whole loop as one block
+        return pc == lastPc || start == lastPc;
+    }
+    return false;
+}
+
+//one more iteration on the value read now would leave A and F as they are
+//and branch back, false when the loop was entered some other way
+bool IdleLoopDetector::isSteady(Loop const & loop)
+{
+    uint8_t a = loop.isPolling ? _memory.readInMemory(loop.polledAdress)
+        : _memory.get8BitRegister(IMemory::REG8BIT::A);
+    uint8_t f = _memory.get8BitRegister(IMemory::REG8BIT::F);
+    uint8_t const z = 1 << static_cast<int>(IMemory::FLAG::Z);
+    uint8_t const h = 1 << static_cast<int>(IMemory::FLAG::H);
+    uint8_t const c = 1 << static_cast<int>(IMemory::FLAG::C);
+    bool isTaken = true;
+    for (int index = loop.isPolling ? 1 : 0; index < loop.length; index++) {
+        uint8_t operand = loop.operands[index];
+        switch (loop.opCodes[index]) {
+        case 0xFE:
+            f = (f & 0x0F) | IMemory::computeAluFlags(IMemory::ALU_OPERATION::SUB, a, operand, false);
+            break;
+        case 0xE6: case 0xA7:
+            a &= loop.opCodes[index] == 0xA7 ? a : operand;
+            f = (f & 0x0F) | (a == 0 ? z : 0) | h;
+            break;
+        case 0xB7:
+            f = (f & 0x0F) | (a == 0 ? z : 0);
+            break;
+        case 0xCB:
+            f = (f & (0x0F | c)) | (((a >> ((operand >> 3) & 0x07)) & 0x01) ? 0 : z) | h;
+            break;
+        case 0x20: case 0xC2: isTaken = !(f & z); break;
+        case 0x28: case 0xCA: isTaken = f & z; break;
+        case 0x30: case 0xD2: isTaken = !(f & c); break;
+        case 0x38: case 0xDA: isTaken = f & c; break;
+        }
+    }
+    return isTaken
+        && a == _memory.get8BitRegister(IMemory::REG8BIT::A)
+        && f == _memory.get8BitRegister(IMemory::REG8BIT::F);
+}
+
+bool IdleLoopDetector::isPolled(uint16_t adress) const
+{
+    return adress == 0xff44 || adress == 0xff41 || adress == 0xff0f;
+}
+
+void IdleLoopDetector::add(Loop& loop, uint16_t pc, int cycles, uint16_t nextPc)
+{
+    loop.opCodes[loop.length] = _memory.readInMemory(pc);
+    loop.operands[loop.length] = _memory.readInMemory(pc + 1);
+    loop.cycles[loop.length] = cycles;
+    loop.nextPcs[loop.length] = nextPc;
+    loop.iterationCycles += cycles;
+    loop.length++;
+}
@@ -1,21 +1,60 @@
 #include "instructionhandler.hpp"
+#include "memory.hpp"
 
-InstructionHandler::InstructionHandler(IMemory& memory, IInterruptHandler& interruptHandler)
+template <class MEMORY>
+BasicInstructionHandler<MEMORY>::BasicInstructionHandler(MEMORY& memory, IInterruptHandler& interruptHandler)
     :_memory(memory),
-     _interruptHandler(interruptHandler){};
+     _interruptHandler(interruptHandler)
+{
+    fillDispatchTable();
+}
      // _bootRom(BootRom()){};
 
-int InstructionHandler::doInstruction(uint8_t opCode)
+template <class MEMORY>
+void BasicInstructionHandler<MEMORY>::fillDispatchTable()
+{
+    for (auto const & pair : _instructions) {
+        _dispatchTable[pair.first] = pair.second.get();
+    }
+    for (auto const & pair : _binaryInstructions) {
+        _dispatchTable[binaryInstructionsOffset + pair.first] = pair.second.get();
+    }
+}
+
+template <class MEMORY>
+int BasicInstructionHandler<MEMORY>::doInstruction(uint8_t opCode)
 {
-    auto instructMapIt = _instructions.find(opCode);
-    if (instructMapIt == _instructions.end()) {
-        throw InstructionException(__PRETTY_FUNCTION__);
+    BasicInstructions<MEMORY>* instruction = _dispatchTable[opCode];
+    if (instruction == nullptr) {
+        _interruptHandler.lockUp(_memory.get16BitRegister(IMemory::REG16BIT::PC), opCode);
+        return 4;
+    }
+#if GB_PROFILE
+    if (_profiler != nullptr) {
+        uint16_t pc = _memory.get16BitRegister(IMemory::REG16BIT::PC);
+        uint8_t cbOpCode = opCode == 0xCB ? _memory.readInMemory(pc + 1) : 0;
+        int cycles = instruction->doOp(_memory);
+        _profiler->record(pc, opCode, cbOpCode, cycles);
+        return cycles;
     }
-    std::shared_ptr<IInstructions> instruction = instructMapIt->second;
-    int cycle = instruction->doOp(_memory);
-    _latestReadableInstruction = instruction->getReadableInstruction();
-    return cycle;
+#endif
+    return instruction->doOp(_memory);
 }
+
+template <class MEMORY>
+void BasicInstructionHandler<MEMORY>::setProfiler(Profiler* profiler)
+{
+    _profiler = profiler;
+}
+
+template <class MEMORY>
+BasicDispatchTable<MEMORY> const & BasicInstructionHandler<MEMORY>::getDispatchTable() const
+{
+    return _dispatchTable;
+}
+
+template class BasicInstructionHandler<IMemory>;
+template class BasicInstructionHandler<Memory>;
 // bool InstructionHandler::boot()
 // {
 //     // uint16_t& PC = _memory._registers.pc;
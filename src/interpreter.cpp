@@ -0,0 +1,764 @@
+#include "interpreter.hpp"
+#include "instructionhandler.hpp"
+
+//GCC and clang jump straight through a label table,
+//other compilers get the same bodies as switch cases
+#if defined(__GNUC__)
+#define GB_COMPUTED_GOTO
+#endif
+
+#ifdef GB_COMPUTED_GOTO
+#define OPCODE(opCode) op_##opCode
+#define ILLEGAL_OPCODE op_illegal
+#else
+#define OPCODE(opCode) case opCode
+#define ILLEGAL_OPCODE default
+#endif
+
+//bytes taken by each opCode, operand included
+static uint8_t const instructionLength[0x100] = {
+    1, 3, 1, 1, 1, 1, 2, 1, 3, 1, 1, 1, 1, 1, 2, 1,
+    2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+    2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+    2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 1, 2, 1,
+    2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+    2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+};
+
+//the most cycles each opCode takes, 0xCB with (HL)
+static uint8_t const maxCycles[0x100] = {
+     4, 12,  8,  8,  4,  4,  8,  4, 20,  8,  8,  8,  4,  4,  8,  4,
+     4, 12,  8,  8,  4,  4,  8,  4, 12,  8,  8,  8,  4,  4,  8,  4,
+    12, 12,  8,  8,  4,  4,  8,  4, 12,  8,  8,  8,  4,  4,  8,  4,
+    12, 12,  8,  8, 12, 12, 12,  4, 12,  8,  8,  8,  4,  4,  8,  4,
+     4,  4,  4,  4,  4,  4,  8,  4,  4,  4,  4,  4,  4,  4,  8,  4,
+     4,  4,  4,  4,  4,  4,  8,  4,  4,  4,  4,  4,  4,  4,  8,  4,
+     4,  4,  4,  4,  4,  4,  8,  4,  4,  4,  4,  4,  4,  4,  8,  4,
+     8,  8,  8,  8,  8,  8,  4,  8,  4,  4,  4,  4,  4,  4,  8,  4,
+     4,  4,  4,  4,  4,  4,  8,  4,  4,  4,  4,  4,  4,  4,  8,  4,
+     4,  4,  4,  4,  4,  4,  8,  4,  4,  4,  4,  4,  4,  4,  8,  4,
+     4,  4,  4,  4,  4,  4,  8,  4,  4,  4,  4,  4,  4,  4,  8,  4,
+     4,  4,  4,  4,  4,  4,  8,  4,  4,  4,  4,  4,  4,  4,  8,  4,
+    20, 12, 16, 16, 24, 16,  8, 16, 20, 16, 16, 20, 24, 24,  8, 16,
+    20, 12, 16,  4, 24, 16,  8, 16, 20, 16, 16,  4, 24,  4,  8, 16,
+    12, 12,  8,  4,  4, 16,  8, 16, 16,  4, 16,  4,  4,  4,  8, 16,
+    12, 12,  8,  4,  4, 16,  8, 16, 12,  8, 16,  4,  4,  4,  8, 16,
+};
+
+Interpreter::Interpreter(Memory& memory, IInterruptHandler& interruptHandler)
+    :_memory(memory),
+     _registers(memory.getRegisters()),
+     _interruptHandler(interruptHandler),
+     _binaryRegisters{&_registers.b, &_registers.c, &_registers.d, &_registers.e,
+                      &_registers.h, &_registers.l, nullptr, &_registers.a}
+{
+}
+
+int Interpreter::doInstruction(uint8_t opCode)
+{
+    uint8_t length = instructionLength[opCode];
+    uint16_t operand = 0;
+    if (length > 1) {
+        operand = _memory.readInMemory(_registers.pc + 1);
+    }
+    if (length > 2) {
+        operand |= static_cast<uint16_t>(_memory.readInMemory(_registers.pc + 2)) << 8;
+    }
+    return execute(opCode, operand);
+}
+
+void Interpreter::setProfiler(Profiler* profiler)
+{
+    _profiler = profiler;
+}
+
+#if GB_PROFILE
+int Interpreter::execute(uint8_t opCode, uint16_t operand)
+{
+    uint16_t pc = _registers.pc;
+    int cycles = dispatch(opCode, operand);
+    if (_profiler != nullptr) {
+        _profiler->record(pc, opCode, operand & 0xff, cycles);
+    }
+    return cycles;
+}
+
+int Interpreter::dispatch(uint8_t opCode, uint16_t operand)
+#else
+int Interpreter::execute(uint8_t opCode, uint16_t operand)
+#endif
+{
+    _operand = operand;
+#ifdef GB_COMPUTED_GOTO
+    static void* const opCodeLabels[0x100] = {
+        &&op_0x00, &&op_0x01, &&op_0x02, &&op_0x03, &&op_0x04, &&op_0x05, &&op_0x06, &&op_0x07,
+        &&op_0x08, &&op_0x09, &&op_0x0A, &&op_0x0B, &&op_0x0C, &&op_0x0D, &&op_0x0E, &&op_0x0F,
+        &&op_0x10, &&op_0x11, &&op_0x12, &&op_0x13, &&op_0x14, &&op_0x15, &&op_0x16, &&op_0x17,
+        &&op_0x18, &&op_0x19, &&op_0x1A, &&op_0x1B, &&op_0x1C, &&op_0x1D, &&op_0x1E, &&op_0x1F,
+        &&op_0x20, &&op_0x21, &&op_0x22, &&op_0x23, &&op_0x24, &&op_0x25, &&op_0x26, &&op_0x27,
+        &&op_0x28, &&op_0x29, &&op_0x2A, &&op_0x2B, &&op_0x2C, &&op_0x2D, &&op_0x2E, &&op_0x2F,
+        &&op_0x30, &&op_0x31, &&op_0x32, &&op_0x33, &&op_0x34, &&op_0x35, &&op_0x36, &&op_0x37,
+        &&op_0x38, &&op_0x39, &&op_0x3A, &&op_0x3B, &&op_0x3C, &&op_0x3D, &&op_0x3E, &&op_0x3F,
+        &&op_0x40, &&op_0x41, &&op_0x42, &&op_0x43, &&op_0x44, &&op_0x45, &&op_0x46, &&op_0x47,
+        &&op_0x48, &&op_0x49, &&op_0x4A, &&op_0x4B, &&op_0x4C, &&op_0x4D, &&op_0x4E, &&op_0x4F,
+        &&op_0x50, &&op_0x51, &&op_0x52, &&op_0x53, &&op_0x54, &&op_0x55, &&op_0x56, &&op_0x57,
+        &&op_0x58, &&op_0x59, &&op_0x5A, &&op_0x5B, &&op_0x5C, &&op_0x5D, &&op_0x5E, &&op_0x5F,
+        &&op_0x60, &&op_0x61, &&op_0x62, &&op_0x63, &&op_0x64, &&op_0x65, &&op_0x66, &&op_0x67,
+        &&op_0x68, &&op_0x69, &&op_0x6A, &&op_0x6B, &&op_0x6C, &&op_0x6D, &&op_0x6E, &&op_0x6F,
+        &&op_0x70, &&op_0x71, &&op_0x72, &&op_0x73, &&op_0x74, &&op_0x75, &&op_0x76, &&op_0x77,
+        &&op_0x78, &&op_0x79, &&op_0x7A, &&op_0x7B, &&op_0x7C, &&op_0x7D, &&op_0x7E, &&op_0x7F,
+        &&op_0x80, &&op_0x81, &&op_0x82, &&op_0x83, &&op_0x84, &&op_0x85, &&op_0x86, &&op_0x87,
+        &&op_0x88, &&op_0x89, &&op_0x8A, &&op_0x8B, &&op_0x8C, &&op_0x8D, &&op_0x8E, &&op_0x8F,
+        &&op_0x90, &&op_0x91, &&op_0x92, &&op_0x93, &&op_0x94, &&op_0x95, &&op_0x96, &&op_0x97,
+        &&op_0x98, &&op_0x99, &&op_0x9A, &&op_0x9B, &&op_0x9C, &&op_0x9D, &&op_0x9E, &&op_0x9F,
+        &&op_0xA0, &&op_0xA1, &&op_0xA2, &&op_0xA3, &&op_0xA4, &&op_0xA5, &&op_0xA6, &&op_0xA7,
+        &&op_0xA8, &&op_0xA9, &&op_0xAA, &&op_0xAB, &&op_0xAC, &&op_0xAD, &&op_0xAE, &&op_0xAF,
+        &&op_0xB0, &&op_0xB1, &&op_0xB2, &&op_0xB3, &&op_0xB4, &&op_0xB5, &&op_0xB6, &&op_0xB7,
+        &&op_0xB8, &&op_0xB9, &&op_0xBA, &&op_0xBB, &&op_0xBC, &&op_0xBD, &&op_0xBE, &&op_0xBF,
+        &&op_0xC0, &&op_0xC1, &&op_0xC2, &&op_0xC3, &&op_0xC4, &&op_0xC5, &&op_0xC6, &&op_0xC7,
+        &&op_0xC8, &&op_0xC9, &&op_0xCA, &&op_0xCB, &&op_0xCC, &&op_0xCD, &&op_0xCE, &&op_0xCF,
+        &&op_0xD0, &&op_0xD1, &&op_0xD2, &&op_illegal, &&op_0xD4, &&op_0xD5, &&op_0xD6, &&op_0xD7,
+        &&op_0xD8, &&op_0xD9, &&op_0xDA, &&op_illegal, &&op_0xDC, &&op_illegal, &&op_0xDE, &&op_0xDF,
+        &&op_0xE0, &&op_0xE1, &&op_0xE2, &&op_illegal, &&op_illegal, &&op_0xE5, &&op_0xE6, &&op_0xE7,
+        &&op_0xE8, &&op_0xE9, &&op_0xEA, &&op_illegal, &&op_illegal, &&op_illegal, &&op_0xEE, &&op_0xEF,
+        &&op_0xF0, &&op_0xF1, &&op_0xF2, &&op_0xF3, &&op_illegal, &&op_0xF5, &&op_0xF6, &&op_0xF7,
+        &&op_0xF8, &&op_0xF9, &&op_0xFA, &&op_0xFB, &&op_illegal, &&op_illegal, &&op_0xFE, &&op_0xFF,
+    };
+    goto *opCodeLabels[opCode];
+#else
+    switch (opCode) {
+#endif
+    //0x00 - 0x3F, RLCA RRCA RLA RRA clear Z
+    OPCODE(0x00): return next(1, 4);
+    OPCODE(0x01): _registers.bc = readNext16Bit(); return next(3, 12);
+    OPCODE(0x02): _memory.writeInMemory(_registers.a, _registers.bc); return next(1, 8);
+    OPCODE(0x03): incDec16Bit(_registers.bc, 1); return next(1, 8);
+    OPCODE(0x04): _registers.b = incDec(_registers.b, 1); return next(1, 4);
+    OPCODE(0x05): _registers.b = incDec(_registers.b, -1); return next(1, 4);
+    OPCODE(0x06): _registers.b = readNext8Bit(); return next(2, 8);
+    OPCODE(0x07): _registers.a = rotateLeftCarry(_registers.a); setFlags(0x80, 0); return next(1, 4);
+    OPCODE(0x08): {
+        uint16_t adress = readNext16Bit();
+        _memory.writeInMemory(_registers.sp & 0xff, adress);
+        _memory.writeInMemory(_registers.sp >> 8, adress + 1);
+        return next(3, 20);
+    }
+    OPCODE(0x09): addToHL(_registers.bc); return next(1, 8);
+    OPCODE(0x0A): _registers.a = _memory.readInMemory(_registers.bc); return next(1, 8);
+    OPCODE(0x0B): incDec16Bit(_registers.bc, -1); return next(1, 8);
+    OPCODE(0x0C): _registers.c = incDec(_registers.c, 1); return next(1, 4);
+    OPCODE(0x0D): _registers.c = incDec(_registers.c, -1); return next(1, 4);
+    OPCODE(0x0E): _registers.c = readNext8Bit(); return next(2, 8);
+    OPCODE(0x0F): _registers.a = rotateRightCarry(_registers.a); setFlags(0x80, 0); return next(1, 4);
+
+    //no joypad yet, STOP waits like HALT
+    OPCODE(0x10): _interruptHandler.halt(); return next(2, 4);
+    OPCODE(0x11): _registers.de = readNext16Bit(); return next(3, 12);
+    OPCODE(0x12): _memory.writeInMemory(_registers.a, _registers.de); return next(1, 8);
+    OPCODE(0x13): incDec16Bit(_registers.de, 1); return next(1, 8);
+    OPCODE(0x14): _registers.d = incDec(_registers.d, 1); return next(1, 4);
+    OPCODE(0x15): _registers.d = incDec(_registers.d, -1); return next(1, 4);
+    OPCODE(0x16): _registers.d = readNext8Bit(); return next(2, 8);
+    OPCODE(0x17): _registers.a = rotateLeft(_registers.a); setFlags(0x80, 0); return next(1, 4);
+    OPCODE(0x18): return jumpRelativeIf(true);
+    OPCODE(0x19): addToHL(_registers.de); return next(1, 8);
+    OPCODE(0x1A): _registers.a = _memory.readInMemory(_registers.de); return next(1, 8);
+    OPCODE(0x1B): incDec16Bit(_registers.de, -1); return next(1, 8);
+    OPCODE(0x1C): _registers.e = incDec(_registers.e, 1); return next(1, 4);
+    OPCODE(0x1D): _registers.e = incDec(_registers.e, -1); return next(1, 4);
+    OPCODE(0x1E): _registers.e = readNext8Bit(); return next(2, 8);
+    OPCODE(0x1F): _registers.a = rotateRight(_registers.a); setFlags(0x80, 0); return next(1, 4);
+
+    OPCODE(0x20): return jumpRelativeIf(!isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0x21): _registers.hl = readNext16Bit(); return next(3, 12);
+    OPCODE(0x22): _memory.writeInMemory(_registers.a, _registers.hl++); return next(1, 8);
+    OPCODE(0x23): incDec16Bit(_registers.hl, 1); return next(1, 8);
+    OPCODE(0x24): _registers.h = incDec(_registers.h, 1); return next(1, 4);
+    OPCODE(0x25): _registers.h = incDec(_registers.h, -1); return next(1, 4);
+    OPCODE(0x26): _registers.h = readNext8Bit(); return next(2, 8);
+    OPCODE(0x27): decimalAdjust(); return next(1, 4);
+    OPCODE(0x28): return jumpRelativeIf(isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0x29): addToHL(_registers.hl); return next(1, 8);
+    OPCODE(0x2A): _registers.a = _memory.readInMemory(_registers.hl++); return next(1, 8);
+    OPCODE(0x2B): incDec16Bit(_registers.hl, -1); return next(1, 8);
+    OPCODE(0x2C): _registers.l = incDec(_registers.l, 1); return next(1, 4);
+    OPCODE(0x2D): _registers.l = incDec(_registers.l, -1); return next(1, 4);
+    OPCODE(0x2E): _registers.l = readNext8Bit(); return next(2, 8);
+    OPCODE(0x2F):
+        _registers.a = ~_registers.a;
+        setFlags(0x60, flagIf(IMemory::FLAG::N, true) | flagIf(IMemory::FLAG::H, true));
+        return next(1, 4);
+
+    OPCODE(0x30): return jumpRelativeIf(!isSetFlag(IMemory::FLAG::C));
+    OPCODE(0x31): _registers.sp = readNext16Bit(); return next(3, 12);
+    OPCODE(0x32): _memory.writeInMemory(_registers.a, _registers.hl--); return next(1, 8);
+    OPCODE(0x33): incDec16Bit(_registers.sp, 1); return next(1, 8);
+    OPCODE(0x34): {
+        uint8_t value = _memory.readInMemory(_registers.hl);
+        _memory.writeInMemory(incDec(value, 1), _registers.hl);
+        return next(1, 12);
+    }
+    OPCODE(0x35): {
+        uint8_t value = _memory.readInMemory(_registers.hl);
+        _memory.writeInMemory(incDec(value, -1), _registers.hl);
+        return next(1, 12);
+    }
+    OPCODE(0x36): _memory.writeInMemory(readNext8Bit(), _registers.hl); return next(2, 12);
+    OPCODE(0x37):
+        setFlags(0x70, flagIf(IMemory::FLAG::C, true));
+        return next(1, 4);
+    OPCODE(0x38): return jumpRelativeIf(isSetFlag(IMemory::FLAG::C));
+    OPCODE(0x39): addToHL(_registers.sp); return next(1, 8);
+    OPCODE(0x3A): _registers.a = _memory.readInMemory(_registers.hl--); return next(1, 8);
+    OPCODE(0x3B): incDec16Bit(_registers.sp, -1); return next(1, 8);
+    OPCODE(0x3C): _registers.a = incDec(_registers.a, 1); return next(1, 4);
+    OPCODE(0x3D): _registers.a = incDec(_registers.a, -1); return next(1, 4);
+    OPCODE(0x3E): _registers.a = readNext8Bit(); return next(2, 8);
+    OPCODE(0x3F):
+        setFlags(0x70, flagIf(IMemory::FLAG::C, !isSetFlag(IMemory::FLAG::C)));
+        return next(1, 4);
+
+    //0x40 - 0x7F ld r,r
+    OPCODE(0x40): return next(1, 4);
+    OPCODE(0x41): _registers.b = _registers.c; return next(1, 4);
+    OPCODE(0x42): _registers.b = _registers.d; return next(1, 4);
+    OPCODE(0x43): _registers.b = _registers.e; return next(1, 4);
+    OPCODE(0x44): _registers.b = _registers.h; return next(1, 4);
+    OPCODE(0x45): _registers.b = _registers.l; return next(1, 4);
+    OPCODE(0x46): _registers.b = _memory.readInMemory(_registers.hl); return next(1, 8);
+    OPCODE(0x47): _registers.b = _registers.a; return next(1, 4);
+    OPCODE(0x48): _registers.c = _registers.b; return next(1, 4);
+    OPCODE(0x49): return next(1, 4);
+    OPCODE(0x4A): _registers.c = _registers.d; return next(1, 4);
+    OPCODE(0x4B): _registers.c = _registers.e; return next(1, 4);
+    OPCODE(0x4C): _registers.c = _registers.h; return next(1, 4);
+    OPCODE(0x4D): _registers.c = _registers.l; return next(1, 4);
+    OPCODE(0x4E): _registers.c = _memory.readInMemory(_registers.hl); return next(1, 8);
+    OPCODE(0x4F): _registers.c = _registers.a; return next(1, 4);
+
+    OPCODE(0x50): _registers.d = _registers.b; return next(1, 4);
+    OPCODE(0x51): _registers.d = _registers.c; return next(1, 4);
+    OPCODE(0x52): return next(1, 4);
+    OPCODE(0x53): _registers.d = _registers.e; return next(1, 4);
+    OPCODE(0x54): _registers.d = _registers.h; return next(1, 4);
+    OPCODE(0x55): _registers.d = _registers.l; return next(1, 4);
+    OPCODE(0x56): _registers.d = _memory.readInMemory(_registers.hl); return next(1, 8);
+    OPCODE(0x57): _registers.d = _registers.a; return next(1, 4);
+    OPCODE(0x58): _registers.e = _registers.b; return next(1, 4);
+    OPCODE(0x59): _registers.e = _registers.c; return next(1, 4);
+    OPCODE(0x5A): _registers.e = _registers.d; return next(1, 4);
+    OPCODE(0x5B): return next(1, 4);
+    OPCODE(0x5C): _registers.e = _registers.h; return next(1, 4);
+    OPCODE(0x5D): _registers.e = _registers.l; return next(1, 4);
+    OPCODE(0x5E): _registers.e = _memory.readInMemory(_registers.hl); return next(1, 8);
+    OPCODE(0x5F): _registers.e = _registers.a; return next(1, 4);
+
+    OPCODE(0x60): _registers.h = _registers.b; return next(1, 4);
+    OPCODE(0x61): _registers.h = _registers.c; return next(1, 4);
+    OPCODE(0x62): _registers.h = _registers.d; return next(1, 4);
+    OPCODE(0x63): _registers.h = _registers.e; return next(1, 4);
+    OPCODE(0x64): return next(1, 4);
+    OPCODE(0x65): _registers.h = _registers.l; return next(1, 4);
+    OPCODE(0x66): _registers.h = _memory.readInMemory(_registers.hl); return next(1, 8);
+    OPCODE(0x67): _registers.h = _registers.a; return next(1, 4);
+    OPCODE(0x68): _registers.l = _registers.b; return next(1, 4);
+    OPCODE(0x69): _registers.l = _registers.c; return next(1, 4);
+    OPCODE(0x6A): _registers.l = _registers.d; return next(1, 4);
+    OPCODE(0x6B): _registers.l = _registers.e; return next(1, 4);
+    OPCODE(0x6C): _registers.l = _registers.h; return next(1, 4);
+    OPCODE(0x6D): return next(1, 4);
+    OPCODE(0x6E): _registers.l = _memory.readInMemory(_registers.hl); return next(1, 8);
+    OPCODE(0x6F): _registers.l = _registers.a; return next(1, 4);
+
+    OPCODE(0x70): _memory.writeInMemory(_registers.b, _registers.hl); return next(1, 8);
+    OPCODE(0x71): _memory.writeInMemory(_registers.c, _registers.hl); return next(1, 8);
+    OPCODE(0x72): _memory.writeInMemory(_registers.d, _registers.hl); return next(1, 8);
+    OPCODE(0x73): _memory.writeInMemory(_registers.e, _registers.hl); return next(1, 8);
+    OPCODE(0x74): _memory.writeInMemory(_registers.h, _registers.hl); return next(1, 8);
+    OPCODE(0x75): _memory.writeInMemory(_registers.l, _registers.hl); return next(1, 8);
+    OPCODE(0x76): _interruptHandler.halt(); return next(1, 4);
+    OPCODE(0x77): _memory.writeInMemory(_registers.a, _registers.hl); return next(1, 8);
+    OPCODE(0x78): _registers.a = _registers.b; return next(1, 4);
+    OPCODE(0x79): _registers.a = _registers.c; return next(1, 4);
+    OPCODE(0x7A): _registers.a = _registers.d; return next(1, 4);
+    OPCODE(0x7B): _registers.a = _registers.e; return next(1, 4);
+    OPCODE(0x7C): _registers.a = _registers.h; return next(1, 4);
+    OPCODE(0x7D): _registers.a = _registers.l; return next(1, 4);
+    OPCODE(0x7E): _registers.a = _memory.readInMemory(_registers.hl); return next(1, 8);
+    OPCODE(0x7F): return next(1, 4);
+
+    //0x80 - 0xBF alu a,r
+    OPCODE(0x80): add(_registers.b); return next(1, 4);
+    OPCODE(0x81): add(_registers.c); return next(1, 4);
+    OPCODE(0x82): add(_registers.d); return next(1, 4);
+    OPCODE(0x83): add(_registers.e); return next(1, 4);
+    OPCODE(0x84): add(_registers.h); return next(1, 4);
+    OPCODE(0x85): add(_registers.l); return next(1, 4);
+    OPCODE(0x86): add(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0x87): add(_registers.a); return next(1, 4);
+    OPCODE(0x88): adc(_registers.b); return next(1, 4);
+    OPCODE(0x89): adc(_registers.c); return next(1, 4);
+    OPCODE(0x8A): adc(_registers.d); return next(1, 4);
+    OPCODE(0x8B): adc(_registers.e); return next(1, 4);
+    OPCODE(0x8C): adc(_registers.h); return next(1, 4);
+    OPCODE(0x8D): adc(_registers.l); return next(1, 4);
+    OPCODE(0x8E): adc(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0x8F): adc(_registers.a); return next(1, 4);
+
+    OPCODE(0x90): sub(_registers.b); return next(1, 4);
+    OPCODE(0x91): sub(_registers.c); return next(1, 4);
+    OPCODE(0x92): sub(_registers.d); return next(1, 4);
+    OPCODE(0x93): sub(_registers.e); return next(1, 4);
+    OPCODE(0x94): sub(_registers.h); return next(1, 4);
+    OPCODE(0x95): sub(_registers.l); return next(1, 4);
+    OPCODE(0x96): sub(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0x97): sub(_registers.a); return next(1, 4);
+    OPCODE(0x98): sbc(_registers.b); return next(1, 4);
+    OPCODE(0x99): sbc(_registers.c); return next(1, 4);
+    OPCODE(0x9A): sbc(_registers.d); return next(1, 4);
+    OPCODE(0x9B): sbc(_registers.e); return next(1, 4);
+    OPCODE(0x9C): sbc(_registers.h); return next(1, 4);
+    OPCODE(0x9D): sbc(_registers.l); return next(1, 4);
+    OPCODE(0x9E): sbc(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0x9F): sbc(_registers.a); return next(1, 4);
+
+    OPCODE(0xA0): logicalAnd(_registers.b); return next(1, 4);
+    OPCODE(0xA1): logicalAnd(_registers.c); return next(1, 4);
+    OPCODE(0xA2): logicalAnd(_registers.d); return next(1, 4);
+    OPCODE(0xA3): logicalAnd(_registers.e); return next(1, 4);
+    OPCODE(0xA4): logicalAnd(_registers.h); return next(1, 4);
+    OPCODE(0xA5): logicalAnd(_registers.l); return next(1, 4);
+    OPCODE(0xA6): logicalAnd(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0xA7): logicalAnd(_registers.a); return next(1, 4);
+    OPCODE(0xA8): logicalXor(_registers.b); return next(1, 4);
+    OPCODE(0xA9): logicalXor(_registers.c); return next(1, 4);
+    OPCODE(0xAA): logicalXor(_registers.d); return next(1, 4);
+    OPCODE(0xAB): logicalXor(_registers.e); return next(1, 4);
+    OPCODE(0xAC): logicalXor(_registers.h); return next(1, 4);
+    OPCODE(0xAD): logicalXor(_registers.l); return next(1, 4);
+    OPCODE(0xAE): logicalXor(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0xAF): logicalXor(_registers.a); return next(1, 4);
+
+    OPCODE(0xB0): logicalOr(_registers.b); return next(1, 4);
+    OPCODE(0xB1): logicalOr(_registers.c); return next(1, 4);
+    OPCODE(0xB2): logicalOr(_registers.d); return next(1, 4);
+    OPCODE(0xB3): logicalOr(_registers.e); return next(1, 4);
+    OPCODE(0xB4): logicalOr(_registers.h); return next(1, 4);
+    OPCODE(0xB5): logicalOr(_registers.l); return next(1, 4);
+    OPCODE(0xB6): logicalOr(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0xB7): logicalOr(_registers.a); return next(1, 4);
+    OPCODE(0xB8): cp(_registers.b); return next(1, 4);
+    OPCODE(0xB9): cp(_registers.c); return next(1, 4);
+    OPCODE(0xBA): cp(_registers.d); return next(1, 4);
+    OPCODE(0xBB): cp(_registers.e); return next(1, 4);
+    OPCODE(0xBC): cp(_registers.h); return next(1, 4);
+    OPCODE(0xBD): cp(_registers.l); return next(1, 4);
+    OPCODE(0xBE): cp(_memory.readInMemory(_registers.hl)); return next(1, 8);
+    OPCODE(0xBF): cp(_registers.a); return next(1, 4);
+
+    //0xC0 - 0xFF
+    OPCODE(0xC0): return retIf(!isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0xC1): _registers.bc = pop(); return next(1, 12);
+    OPCODE(0xC2): return jumpIf(!isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0xC3): return jumpIf(true);
+    OPCODE(0xC4): return callIf(!isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0xC5): push(_registers.bc); return next(1, 16);
+    OPCODE(0xC6): add(readNext8Bit()); return next(2, 8);
+    OPCODE(0xC7): return restart(0x00);
+    OPCODE(0xC8): return retIf(isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0xC9): _registers.pc = pop(); return 16;
+    OPCODE(0xCA): return jumpIf(isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0xCB): {
+        int cycles = 4 + doBinaryInstruction(readNext8Bit());
+        return next(2, cycles);
+    }
+    OPCODE(0xCC): return callIf(isSetFlag(IMemory::FLAG::Z));
+    OPCODE(0xCD): return callIf(true);
+    OPCODE(0xCE): adc(readNext8Bit()); return next(2, 8);
+    OPCODE(0xCF): return restart(0x08);
+
+    OPCODE(0xD0): return retIf(!isSetFlag(IMemory::FLAG::C));
+    OPCODE(0xD1): _registers.de = pop(); return next(1, 12);
+    OPCODE(0xD2): return jumpIf(!isSetFlag(IMemory::FLAG::C));
+    OPCODE(0xD4): return callIf(!isSetFlag(IMemory::FLAG::C));
+    OPCODE(0xD5): push(_registers.de); return next(1, 16);
+    OPCODE(0xD6): sub(readNext8Bit()); return next(2, 8);
+    OPCODE(0xD7): return restart(0x10);
+    OPCODE(0xD8): return retIf(isSetFlag(IMemory::FLAG::C));
+    OPCODE(0xD9):
+        _registers.pc = pop();
+        _interruptHandler.enableMasterSwitch();
+        return 16;
+    OPCODE(0xDA): return jumpIf(isSetFlag(IMemory::FLAG::C));
+    OPCODE(0xDC): return callIf(isSetFlag(IMemory::FLAG::C));
+    OPCODE(0xDE): sbc(readNext8Bit()); return next(2, 8);
+    OPCODE(0xDF): return restart(0x18);
+
+    OPCODE(0xE0): _memory.writeInMemory(_registers.a, 0xff00 + readNext8Bit()); return next(2, 12);
+    OPCODE(0xE1): _registers.hl = pop(); return next(1, 12);
+    OPCODE(0xE2): _memory.writeInMemory(_registers.a, 0xff00 + _registers.c); return next(1, 8);
+    OPCODE(0xE5): push(_registers.hl); return next(1, 16);
+    OPCODE(0xE6): logicalAnd(readNext8Bit()); return next(2, 8);
+    OPCODE(0xE7): return restart(0x20);
+    OPCODE(0xE8): _registers.sp = addToSP(readNext8Bit()); return next(2, 16);
+    OPCODE(0xE9): _registers.pc = _registers.hl; return 4;
+    OPCODE(0xEA): _memory.writeInMemory(_registers.a, readNext16Bit()); return next(3, 16);
+    OPCODE(0xEE): logicalXor(readNext8Bit()); return next(2, 8);
+    OPCODE(0xEF): return restart(0x28);
+
+    OPCODE(0xF0): _registers.a = _memory.readInMemory(0xff00 + readNext8Bit()); return next(2, 12);
+    //the low nibble of F always reads 0
+    OPCODE(0xF1): _registers.af = pop() & 0xfff0; return next(1, 12);
+    OPCODE(0xF2): _registers.a = _memory.readInMemory(0xff00 + _registers.c); return next(1, 8);
+    OPCODE(0xF3): _interruptHandler.disableMasterSwitch(); return next(1, 4);
+    OPCODE(0xF5): push(_registers.af); return next(1, 16);
+    OPCODE(0xF6): logicalOr(readNext8Bit()); return next(2, 8);
+    OPCODE(0xF7): return restart(0x30);
+    OPCODE(0xF8): _registers.hl = addToSP(readNext8Bit()); return next(2, 12);
+    OPCODE(0xF9): _registers.sp = _registers.hl; return next(1, 8);
+    OPCODE(0xFA): _registers.a = _memory.readInMemory(readNext16Bit()); return next(3, 16);
+    OPCODE(0xFB): _interruptHandler.enableMasterSwitch(); return next(1, 4);
+    OPCODE(0xFE): cp(readNext8Bit()); return next(2, 8);
+    OPCODE(0xFF): return restart(0x38);
+
+    ILLEGAL_OPCODE:
+        _interruptHandler.lockUp(_registers.pc, opCode);
+        return 4;
+#ifndef GB_COMPUTED_GOTO
+    }
+#endif
+}
+
+int Interpreter::doBinaryInstruction(uint8_t opCode)
+{
+    uint8_t* reg = _binaryRegisters[opCode & 0x07];
+    uint8_t value = reg != nullptr ? *reg : _memory.readInMemory(_registers.hl);
+    int cycles = reg != nullptr ? 8 : 16;
+    int bit = (opCode >> 3) & 0x07;
+
+    switch (opCode >> 6) {
+    case 0:
+        switch (bit) {
+        case 0: value = rotateLeftCarry(value); break;
+        case 1: value = rotateRightCarry(value); break;
+        case 2: value = rotateLeft(value); break;
+        case 3: value = rotateRight(value); break;
+        case 4: value = shiftLeft(value); break;
+        case 5: value = shiftRightArithmetic(value); break;
+        case 6: value = swap(value); break;
+        case 7: value = shiftRightLogical(value); break;
+        }
+        break;
+    case 1:
+        setFlags(0xE0, flagIf(IMemory::FLAG::Z, (value & (1 << bit)) == 0) | flagIf(IMemory::FLAG::H, true));
+        return cycles;
+    case 2:
+        value &= ~(1 << bit);
+        break;
+    case 3:
+        value |= 1 << bit;
+        break;
+    }
+    if (reg != nullptr) {
+        *reg = value;
+    }
+    else {
+        _memory.writeInMemory(value, _registers.hl);
+    }
+    return cycles;
+}
+
+int Interpreter::next(uint16_t length, int cycles)
+{
+    _registers.pc += length;
+    return cycles;
+}
+
+uint8_t Interpreter::getInstructionLength(uint8_t opCode)
+{
+    return instructionLength[opCode];
+}
+
+uint8_t Interpreter::getMaxCycles(uint8_t opCode)
+{
+    return maxCycles[opCode];
+}
+
+uint8_t Interpreter::readNext8Bit()
+{
+    return static_cast<uint8_t>(_operand & 0xff);
+}
+
+uint16_t Interpreter::readNext16Bit()
+{
+    return _operand;
+}
+
+void Interpreter::push(uint16_t value)
+{
+    _memory.writeInMemory(static_cast<uint8_t>(value >> 8), _registers.sp - 1);
+    _memory.writeInMemory(static_cast<uint8_t>(value & 0xff), _registers.sp - 2);
+    _registers.sp -= 2;
+}
+
+uint16_t Interpreter::pop()
+{
+    uint8_t lessSignificantBit = _memory.readInMemory(_registers.sp);
+    uint8_t mostSignificantBit = _memory.readInMemory(_registers.sp + 1);
+    _registers.sp += 2;
+    return (static_cast<uint16_t>(mostSignificantBit) << 8) | lessSignificantBit;
+}
+
+void Interpreter::setFlags(uint8_t mask, uint8_t flags)
+{
+    _registers.f = (_registers.f & ~mask) | flags;
+}
+
+uint8_t Interpreter::flagIf(IMemory::FLAG flag, bool isSet)
+{
+    return isSet << static_cast<int>(flag);
+}
+
+bool Interpreter::isSetFlag(IMemory::FLAG flag)
+{
+    return (_registers.f >> static_cast<int>(flag)) & 0x01;
+}
+
+//same flags as IMemory::setAluFlags, which the reference goes through
+uint8_t Interpreter::incDec(uint8_t value, int toAdd)
+{
+    IMemory::ALU_OPERATION operation = toAdd < 0 ? IMemory::ALU_OPERATION::DEC : IMemory::ALU_OPERATION::INC;
+    setFlags(IMemory::getAluFlagsMask(operation), IMemory::computeAluFlags(operation, value, 1, false));
+    return value + toAdd;
+}
+
+//no flag changes
+void Interpreter::incDec16Bit(uint16_t& value, int toAdd)
+{
+    value += toAdd;
+}
+
+void Interpreter::add(uint8_t value)
+{
+    setFlags(0xF0, IMemory::computeAluFlags(IMemory::ALU_OPERATION::ADD, _registers.a, value, false));
+    _registers.a += value;
+}
+
+void Interpreter::adc(uint8_t value)
+{
+    bool carry = isSetFlag(IMemory::FLAG::C);
+    setFlags(0xF0, IMemory::computeAluFlags(IMemory::ALU_OPERATION::ADC, _registers.a, value, carry));
+    _registers.a += value + carry;
+}
+
+void Interpreter::sub(uint8_t value)
+{
+    cp(value);
+    _registers.a -= value;
+}
+
+void Interpreter::sbc(uint8_t value)
+{
+    bool carry = isSetFlag(IMemory::FLAG::C);
+    setFlags(0xF0, IMemory::computeAluFlags(IMemory::ALU_OPERATION::SBC, _registers.a, value, carry));
+    _registers.a -= value + carry;
+}
+
+void Interpreter::cp(uint8_t value)
+{
+    setFlags(0xF0, IMemory::computeAluFlags(IMemory::ALU_OPERATION::SUB, _registers.a, value, false));
+}
+
+void Interpreter::logicalAnd(uint8_t value)
+{
+    _registers.a &= value;
+    setFlags(0xF0, flagIf(IMemory::FLAG::Z, _registers.a == 0x00) | flagIf(IMemory::FLAG::H, true));
+}
+
+void Interpreter::logicalXor(uint8_t value)
+{
+    _registers.a ^= value;
+    setFlags(0xF0, flagIf(IMemory::FLAG::Z, _registers.a == 0x00));
+}
+
+void Interpreter::logicalOr(uint8_t value)
+{
+    _registers.a |= value;
+    setFlags(0xF0, flagIf(IMemory::FLAG::Z, _registers.a == 0x00));
+}
+
+//N H C, Z is kept, the half carry is out of bit 11
+void Interpreter::addToHL(uint16_t value)
+{
+    uint16_t regValue = _registers.hl;
+    setFlags(0x70, flagIf(IMemory::FLAG::H, (regValue & 0x0FFF) + (value & 0x0FFF) > 0x0FFF)
+             | flagIf(IMemory::FLAG::C, (static_cast<uint32_t>(regValue) + value) > 0xffff));
+    _registers.hl = regValue + value;
+}
+
+//SP plus a signed offset, the carries are out of the low byte
+uint16_t Interpreter::addToSP(uint8_t offset)
+{
+    uint16_t regValue = _registers.sp;
+    setFlags(0xF0, flagIf(IMemory::FLAG::H, (regValue & 0x0F) + (offset & 0x0F) > 0x0F)
+             | flagIf(IMemory::FLAG::C, (regValue & 0xFF) + offset > 0xFF));
+    return regValue + static_cast<int8_t>(offset);
+}
+
+//BCD correction of A after an addition or a subtraction
+void Interpreter::decimalAdjust()
+{
+    uint8_t correction = 0;
+    bool carry = isSetFlag(IMemory::FLAG::C);
+    bool isSub = isSetFlag(IMemory::FLAG::N);
+    if (isSetFlag(IMemory::FLAG::H) || (!isSub && (_registers.a & 0x0F) > 0x09)) {
+        correction |= 0x06;
+    }
+    if (carry || (!isSub && _registers.a > 0x99)) {
+        correction |= 0x60;
+        carry = true;
+    }
+    _registers.a = isSub ? _registers.a - correction : _registers.a + correction;
+    setFlags(0xB0, flagIf(IMemory::FLAG::Z, _registers.a == 0x00) | flagIf(IMemory::FLAG::C, carry));
+}
+
+uint8_t Interpreter::setShiftFlags(uint8_t result, bool carry)
+{
+    setFlags(0xF0, flagIf(IMemory::FLAG::Z, result == 0x00) | flagIf(IMemory::FLAG::C, carry));
+    return result;
+}
+
+uint8_t Interpreter::rotateLeftCarry(uint8_t value)
+{
+    return setShiftFlags((value << 1) | (value >> 7), value & 0x80);
+}
+
+uint8_t Interpreter::rotateRightCarry(uint8_t value)
+{
+    return setShiftFlags((value >> 1) | (value << 7), value & 0x01);
+}
+
+uint8_t Interpreter::rotateLeft(uint8_t value)
+{
+    return setShiftFlags((value << 1) | isSetFlag(IMemory::FLAG::C), value & 0x80);
+}
+
+uint8_t Interpreter::rotateRight(uint8_t value)
+{
+    return setShiftFlags((value >> 1) | (isSetFlag(IMemory::FLAG::C) << 7), value & 0x01);
+}
+
+uint8_t Interpreter::shiftLeft(uint8_t value)
+{
+    return setShiftFlags(value << 1, value & 0x80);
+}
+
+uint8_t Interpreter::shiftRightArithmetic(uint8_t value)
+{
+    return setShiftFlags((value >> 1) | (value & 0x80), value & 0x01);
+}
+
+uint8_t Interpreter::shiftRightLogical(uint8_t value)
+{
+    return setShiftFlags(value >> 1, value & 0x01);
+}
+
+uint8_t Interpreter::swap(uint8_t value)
+{
+    return setShiftFlags((value << 4) | (value >> 4), false);
+}
+
+int Interpreter::jumpIf(bool condition)
+{
+    if (!condition) {
+        return next(3, 12);
+    }
+    _registers.pc = readNext16Bit();
+    return 16;
+}
+
+int Interpreter::jumpRelativeIf(bool condition)
+{
+    uint16_t cursor = _registers.pc + 2;
+    int8_t toAdd = static_cast<int8_t>(readNext8Bit());
+    if (!condition) {
+        _registers.pc = cursor;
+        return 8;
+    }
+    _registers.pc = cursor + toAdd;
+    return 12;
+}
+
+bool Interpreter::isConditionMet(uint8_t opCode)
+{
+    switch ((opCode >> 3) & 0x03) {
+    case 0: return !isSetFlag(IMemory::FLAG::Z);
+    case 1: return isSetFlag(IMemory::FLAG::Z);
+    case 2: return !isSetFlag(IMemory::FLAG::C);
+    default: return isSetFlag(IMemory::FLAG::C);
+    }
+}
+
+int Interpreter::callIf(bool condition)
+{
+    if (!condition) {
+        return next(3, 12);
+    }
+    push(_registers.pc + 3);
+    _registers.pc = readNext16Bit();
+    return 24;
+}
+
+int Interpreter::retIf(bool condition)
+{
+    if (!condition) {
+        return next(1, 8);
+    }
+    _registers.pc = pop();
+    return 20;
+}
+
+int Interpreter::restart(uint16_t adress)
+{
+    push(_registers.pc + 1);
+    _registers.pc = adress;
+    return 16;
+}
+
+int Interpreter::aluJumpRelative(uint8_t opCode, uint16_t operand, uint8_t jumpOpCode, uint8_t offset)
+{
+    int cycles = execute(opCode, operand);
+    _operand = offset;
+    return cycles + jumpRelativeIf(isConditionMet(jumpOpCode));
+}
+
+int Interpreter::copyByte(uint8_t loadOpCode, uint8_t storeOpCode)
+{
+    _registers.a = _memory.readInMemory(loadOpCode == 0x2A ? _registers.hl++ : _registers.hl--);
+    _memory.writeInMemory(_registers.a, storeOpCode == 0x12 ? _registers.de : _registers.bc);
+    return next(2, 16);
+}
+
+int Interpreter::loadCompare(uint8_t adress, uint8_t value)
+{
+    _registers.a = _memory.readInMemory(0xff00 + adress);
+    cp(value);
+    return next(4, 20);
+}
+
+int Interpreter::loadCompareJump(uint8_t adress, uint8_t value, uint8_t jumpOpCode, uint8_t offset)
+{
+    int cycles = loadCompare(adress, value);
+    _operand = offset;
+    return cycles + jumpRelativeIf(isConditionMet(jumpOpCode));
+}
@@ -1,13 +1,25 @@
 #include <bitset>
 #include <iostream>
 #include "interupthandler.hpp"
+#include "memory.hpp"
 
-InterruptHandler::InterruptHandler(IMemory& memory)
+template <class MEMORY>
+BasicInterruptHandler<MEMORY>::BasicInterruptHandler(MEMORY& memory)
     :_memory(memory){};
 
 
-void InterruptHandler::doInterrupt()
+template <class MEMORY>
+void BasicInterruptHandler<MEMORY>::doInterrupt()
 {
+    if (_isLocked) {
+        return ;
+    }
+    //an enabled request ends HALT even with the master switch off
+    if (_isHalted
+        && (_memory.readInMemory(_interruptRequestRegister)
+            & _memory.readInMemory(_interruptEnableRegister) & 0x1f)) {
+        _isHalted = false;
+    }
     if (isMasterSwitchEnabled()) {
         uint8_t interruptRequest = _memory.readInMemory(_interruptRequestRegister);
         uint8_t interruptEnabled = _memory.readInMemory(_interruptEnableRegister);
@@ -17,32 +29,57 @@ void InterruptHandler::doInterrupt()
 
         if (interruptRequest) {
             for (int interruptID = 0; interruptID < 5; interruptID++) {
+                //the highest priority one, the others wait for its RETI
                 if (bitsetRequest.test(interruptID)
                     && bitsetEnabled.test(interruptID)) {
                     serviceInterrupt(static_cast<IInterruptHandler::INTERRUPT>(interruptID),
                                      bitsetRequest);
+                    break;
                 }
             }
         }
     }
 }
 
-bool InterruptHandler::isMasterSwitchEnabled()
+template <class MEMORY>
+bool BasicInterruptHandler<MEMORY>::isMasterSwitchEnabled()
 {
     return _masterInterruptSwitch;
 }
 
-void InterruptHandler::enableMasterSwitch()
+template <class MEMORY>
+void BasicInterruptHandler<MEMORY>::setScheduler(IScheduler* scheduler)
+{
+    _scheduler = scheduler;
+}
+
+template <class MEMORY>
+void BasicInterruptHandler<MEMORY>::enableMasterSwitch()
 {
     _masterInterruptSwitch = true;
+    if (_scheduler != nullptr) {
+        _scheduler->wake(IScheduler::EVENT::INTERRUPT);
+    }
 }
 
-void InterruptHandler::disableMasterSwitch()
+template <class MEMORY>
+void BasicInterruptHandler<MEMORY>::disableMasterSwitch()
 {
     _masterInterruptSwitch = false;
 }
 
-void InterruptHandler::requestInterrupt(IInterruptHandler::INTERRUPT id)
+template <class MEMORY>
+void BasicInterruptHandler<MEMORY>::halt()
+{
+    _isHalted = true;
+    //a request may already be pending
+    if (_scheduler != nullptr) {
+        _scheduler->wake(IScheduler::EVENT::INTERRUPT);
+    }
+}
+
+template <class MEMORY>
+void BasicInterruptHandler<MEMORY>::requestInterrupt(IInterruptHandler::INTERRUPT id)
 {
     uint8_t interruptRequest = _memory.readInMemory(_interruptRequestRegister);
     std::bitset<8> bitsetRequest(interruptRequest);
@@ -50,7 +87,8 @@ void InterruptHandler::requestInterrupt(IInterruptHandler::INTERRUPT id)
     _memory.writeInMemory(bitsetRequest.to_ulong(), _interruptRequestRegister);
 }
 
-void InterruptHandler::serviceInterrupt(IInterruptHandler::INTERRUPT id,
+template <class MEMORY>
+void BasicInterruptHandler<MEMORY>::serviceInterrupt(IInterruptHandler::INTERRUPT id,
                                         std::bitset<8> bitsetRequest)
 {
     int const interruptID = static_cast<int>(id);
@@ -62,9 +100,12 @@ void InterruptHandler::serviceInterrupt(IInterruptHandler::INTERRUPT id,
    uint16_t stackPointer = _memory.get16BitRegister(IMemory::REG16BIT::SP);
    uint8_t mostSignificantBit = static_cast<uint8_t>((programCounter >> 8) & 0xff);
    uint8_t lessSignificantBit = static_cast<uint8_t>(programCounter & 0xff);
-   _memory.writeInMemory(lessSignificantBit, stackPointer - 1);
-   _memory.writeInMemory(mostSignificantBit, stackPointer);
+   _memory.writeInMemory(mostSignificantBit, stackPointer - 1);
+   _memory.writeInMemory(lessSignificantBit, stackPointer - 2);
 
    _memory.set16BitRegister(IMemory::REG16BIT::SP, stackPointer - 2);
    _memory.set16BitRegister(IMemory::REG16BIT::PC, serviceRoutineAdress[interruptID]);
 }
+
+template class BasicInterruptHandler<IMemory>;
+template class BasicInterruptHandler<Memory>;
@@ -0,0 +1,751 @@
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include "jit.hpp"
+
+namespace
+{
+    //return value of the native code
+    uint32_t getResult(int instructions, int cycles)
+    {
+        return static_cast<uint32_t>(instructions) << 16 | static_cast<uint32_t>(cycles);
+    }
+}
+
+#ifdef GB_JIT_X86_64
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+    uint8_t const F = offsetof(Registers, f);
+    uint8_t const A = offsetof(Registers, a);
+    uint8_t const BC = offsetof(Registers, bc);
+    uint8_t const DE = offsetof(Registers, de);
+    uint8_t const HL = offsetof(Registers, hl);
+    uint8_t const SP = offsetof(Registers, sp);
+    uint8_t const PC = offsetof(Registers, pc);
+    //opCode 3 bit register field -> B C D E H L (HL) A
+    uint8_t const registerOffsets[8] = {
+        offsetof(Registers, b), offsetof(Registers, c), offsetof(Registers, d),
+        offsetof(Registers, e), offsetof(Registers, h), offsetof(Registers, l),
+        0, A
+    };
+    uint8_t const wordOffsets[4] = {BC, DE, HL, SP};
+
+    //ADD ADC SUB SBC AND XOR OR CP -> x86 "op r/m8, r8", +2 for "op r8, r/m8"
+    //and +4 for "op al, imm8"
+    uint8_t const aluOpCodes[8] = {0x00, 0x10, 0x28, 0x18, 0x20, 0x30, 0x08, 0x38};
+
+    //lahf puts ZF in bit 6, AF in bit 4 and CF in bit 0 of ah, Z H C of F
+    //sit in bits 7 5 4. AF is the carry out of bit 3, the H of the 8 bit ops
+    struct FlagTable
+    {
+        FlagTable()
+        {
+            for (int ah = 0; ah < 0x100; ah++) {
+                flags[ah] = ((ah & 0x40) << 1) | ((ah & 0x10) << 1) | ((ah & 0x01) << 4);
+            }
+        }
+
+        uint8_t flags[0x100];
+    };
+
+    FlagTable const flagTable;
+
+    //the generated code keeps Registers* in rbx, Jit* in r12, the flag table
+    //in r13 and the cycles left before the next event in r14
+    class Emitter
+    {
+    public:
+
+        explicit Emitter(uint8_t* code)
+            :_begin(code),
+             _cursor(code)
+        {
+        }
+
+        size_t size() const
+        {
+            return _cursor - _begin;
+        }
+
+        uint8_t* cursor() const
+        {
+            return _cursor;
+        }
+
+        void emit(std::initializer_list<uint8_t> bytes)
+        {
+            for (uint8_t byte : bytes) {
+                *_cursor++ = byte;
+            }
+        }
+
+        template <class T>
+        void emitValue(T value)
+        {
+            std::memcpy(_cursor, &value, sizeof(T));
+            _cursor += sizeof(T);
+        }
+
+        //the stack is kept aligned for the calls
+        void prologue()
+        {
+            emit({0x53});                   //push rbx
+            emit({0x41, 0x54});             //push r12
+            emit({0x41, 0x55});             //push r13
+            emit({0x41, 0x56});             //push r14
+            emit({0x48, 0x83, 0xEC, 0x08}); //sub rsp, 8
+            emit({0x48, 0x89, 0xFB});       //mov rbx, rdi
+            emit({0x49, 0x89, 0xF4});       //mov r12, rsi
+            emit({0x41, 0x89, 0xD6});       //mov r14d, edx
+            emit({0x49, 0xBD});             //mov r13, flagTable
+            emitValue(reinterpret_cast<uint64_t>(flagTable.flags));
+        }
+
+        //returns eax
+        void epilogue()
+        {
+            emit({0x48, 0x83, 0xC4, 0x08}); //add rsp, 8
+            emit({0x41, 0x5E});             //pop r14
+            emit({0x41, 0x5D});             //pop r13
+            emit({0x41, 0x5C});             //pop r12
+            emit({0x5B});                   //pop rbx
+            emit({0xC3});                   //ret
+        }
+
+        //calls function(jit, esi, edx, ecx, r8d, r9d), the arguments already loaded
+        template <class FUNCTION>
+        void call(FUNCTION function)
+        {
+            emit({0x4C, 0x89, 0xE7});       //mov rdi, r12
+            emit({0x48, 0xB8});             //mov rax, function
+            emitValue(reinterpret_cast<uint64_t>(function));
+            emit({0xFF, 0xD0});             //call rax
+        }
+
+        void moveToEax(uint32_t value)
+        {
+            emit({0xB8});
+            emitValue(value);
+        }
+
+        void moveToEsi(uint32_t value)
+        {
+            emit({0xBE});
+            emitValue(value);
+        }
+
+        void moveToEdx(uint32_t value)
+        {
+            emit({0xBA});
+            emitValue(value);
+        }
+
+        void moveToEcx(uint32_t value)
+        {
+            emit({0xB9});
+            emitValue(value);
+        }
+
+        void moveToR8d(uint32_t value)
+        {
+            emit({0x41, 0xB8});
+            emitValue(value);
+        }
+
+        void moveToR9d(uint32_t value)
+        {
+            emit({0x41, 0xB9});
+            emitValue(value);
+        }
+
+        void moveEaxToEcx()
+        {
+            emit({0x89, 0xC1});
+        }
+
+        void addToEsi(uint32_t value)
+        {
+            emit({0x81, 0xC6});
+            emitValue(value);
+        }
+
+        void addToEdx(uint32_t value)
+        {
+            emit({0x81, 0xC2});
+            emitValue(value);
+        }
+
+        void loadByteToEsi(uint8_t offset)
+        {
+            emit({0x0F, 0xB6, 0x73, offset});
+        }
+
+        void loadByteToEdx(uint8_t offset)
+        {
+            emit({0x0F, 0xB6, 0x53, offset});
+        }
+
+        void loadWordToEsi(uint8_t offset)
+        {
+            emit({0x0F, 0xB7, 0x73, offset});
+        }
+
+        void loadWordToEdx(uint8_t offset)
+        {
+            emit({0x0F, 0xB7, 0x53, offset});
+        }
+
+        void loadByteToAl(uint8_t offset)
+        {
+            emit({0x8A, 0x43, offset});
+        }
+
+        void storeAl(uint8_t offset)
+        {
+            emit({0x88, 0x43, offset});
+        }
+
+        void storeByte(uint8_t offset, uint8_t value)
+        {
+            emit({0xC6, 0x43, offset, value});
+        }
+
+        void storeWord(uint8_t offset, uint16_t value)
+        {
+            emit({0x66, 0xC7, 0x43, offset});
+            emitValue(value);
+        }
+
+        //inc or dec byte [rbx + offset], CF is kept as INC/DEC r keeps C
+        void incDecByte(uint8_t offset, bool isIncrement)
+        {
+            emit({0xFE, static_cast<uint8_t>(isIncrement ? 0x43 : 0x4B), offset});
+        }
+
+        void incDecWord(uint8_t offset, bool isIncrement)
+        {
+            emit({0x66, 0xFF, static_cast<uint8_t>(isIncrement ? 0x43 : 0x4B), offset});
+        }
+
+        //CF = C, for ADC and SBC
+        void loadCarry()
+        {
+            emit({0x66, 0x0F, 0xBA, 0x63, F, 0x04}); //bt word [rbx + F], 4
+        }
+
+        //al = al op byte [rbx + offset]
+        void aluAl(int operation, uint8_t offset)
+        {
+            emit({static_cast<uint8_t>(aluOpCodes[operation] + 2), 0x43, offset});
+        }
+
+        //al = al op cl
+        void aluAlCl(int operation)
+        {
+            emit({aluOpCodes[operation], 0xC8});
+        }
+
+        void aluAlImmediate(int operation, uint8_t value)
+        {
+            emit({static_cast<uint8_t>(aluOpCodes[operation] + 4), value});
+        }
+
+        void saveFlags()
+        {
+            emit({0x9F});                   //lahf
+        }
+
+        //al = the Z H C of the saved flags within mask, with set added
+        void flagsToAl(uint8_t mask, uint8_t set)
+        {
+            emit({0x0F, 0xB6, 0xC4});       //movzx eax, ah
+            emit({0x41, 0x8A, 0x44, 0x05, 0x00}); //mov al, [r13 + rax]
+            if (mask != 0xB0) {
+                emit({0x24, mask});         //and al, mask
+            }
+            if (set != 0) {
+                emit({0x0C, set});          //or al, set
+            }
+        }
+
+        //the flags of al replace those of F outside keptMask
+        void mergeFlags(uint8_t keptMask)
+        {
+            emit({0x80, 0x63, F, keptMask}); //and byte [rbx + F], keptMask
+            emit({0x08, 0x43, F});           //or byte [rbx + F], al
+        }
+
+        //PC and eax for a branch taken when the flags of mask are isSet
+        void branchIf(uint8_t mask, bool isSet, uint16_t nextPc, uint32_t result,
+                      uint16_t target, uint32_t takenResult)
+        {
+            storeWord(PC, nextPc);
+            moveToEax(result);
+            emit({0xF6, 0x43, F, mask});    //test byte [rbx + F], mask
+            //skips the 11 bytes below when the condition fails
+            emit({static_cast<uint8_t>(isSet ? 0x74 : 0x75), 11});
+            storeWord(PC, target);
+            moveToEax(takenResult);
+        }
+
+        //leaves with PC on the instruction unless it ends before the next
+        //event, returns the rel32 to patch
+        uint8_t* jumpIfOverBudget(uint32_t endCycles, uint16_t pc, uint32_t result)
+        {
+            emit({0x41, 0x81, 0xFE});       //cmp r14d, endCycles
+            emitValue(endCycles);
+            //skips the 16 bytes of the exit
+            emit({0x7F, 16});               //jg
+            storeWord(PC, pc);
+            moveToEax(result);
+            emit({0xE9});                   //jmp
+            uint8_t* rel32 = _cursor;
+            emitValue(uint32_t(0));
+            return rel32;
+        }
+
+        //test eax, eax / jnz, returns the rel32 to patch
+        uint8_t* jumpIfNotZero()
+        {
+            emit({0x85, 0xC0, 0x0F, 0x85});
+            uint8_t* rel32 = _cursor;
+            emitValue(uint32_t(0));
+            return rel32;
+        }
+
+        void patch(uint8_t* rel32, uint8_t* target)
+        {
+            int32_t offset = static_cast<int32_t>(target - (rel32 + 4));
+            std::memcpy(rel32, &offset, sizeof(offset));
+        }
+
+    private:
+
+        uint8_t* const _begin;
+        uint8_t* _cursor;
+    };
+
+    //as the Interpreter counts them, the prefix included
+    int getPrefixedCycles(uint8_t opCode)
+    {
+        return (opCode & 0x07) == 0x06 ? 20 : 12;
+    }
+
+    bool isAluOnA(uint8_t opCode)
+    {
+        return (0x80 <= opCode && opCode <= 0xBF) || (opCode & 0xC7) == 0xC6;
+    }
+
+    //N of each ALU operation, AND sets H and the logical ones clear C
+    void emitAluFlags(Emitter& emitter, int operation)
+    {
+        switch (operation) {
+        case 2: case 3: case 7:
+            emitter.flagsToAl(0xB0, 0x40);
+            break;
+        case 4:
+            emitter.flagsToAl(0x80, 0x20);
+            break;
+        case 5: case 6:
+            emitter.flagsToAl(0x80, 0x00);
+            break;
+        default:
+            emitter.flagsToAl(0xB0, 0x00);
+            break;
+        }
+        emitter.storeAl(F);
+    }
+}
+#endif
+
+Jit::Jit(Memory& memory, IInterruptHandler& interruptHandler)
+    :BlockCache(memory, interruptHandler),
+     _nativeBlocks(0x10000)
+{
+#ifdef GB_JIT_X86_64
+    void* code = mmap(nullptr, _codeSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code != MAP_FAILED) {
+        _code = static_cast<uint8_t*>(code);
+    }
+    _pageSize = sysconf(_SC_PAGESIZE);
+#endif
+}
+
+Jit::~Jit()
+{
+#ifdef GB_JIT_X86_64
+    if (_code != nullptr) {
+        munmap(_code, _codeSize);
+    }
+#endif
+}
+
+int Jit::run()
+{
+    uint16_t pc = _registers.pc;
+    Block* block = findBlock(pc);
+    if (block == nullptr) {
+        int cycles = _interpreter.doInstruction(_memory.readInMemory(pc));
+        _scheduler->update(cycles);
+        return cycles;
+    }
+    NativeBlock& nativeBlock = _nativeBlocks[pc];
+    if (_isEnabled && nativeBlock.code == nullptr && ++nativeBlock.runs == _hotThreshold) {
+        nativeBlock.code = compile(*block);
+    }
+    //the one scheduler check of the block
+    if (_isEnabled && nativeBlock.code != nullptr) {
+        int budget = _scheduler->getCyclesToNextEvent();
+        if (budget > Interpreter::getMaxCycles(block->microOps[0].opCode)) {
+            return runNative(*block, nativeBlock.code, budget);
+        }
+    }
+    return runBlock(*block);
+}
+
+void Jit::setEnabled(bool isEnabled)
+{
+    _isEnabled = isEnabled;
+}
+
+bool Jit::isEnabled() const
+{
+    return _isEnabled;
+}
+
+bool Jit::isSupported()
+{
+#ifdef GB_JIT_X86_64
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Jit::clear()
+{
+    BlockCache::clear();
+    for (auto& nativeBlock : _nativeBlocks) {
+        nativeBlock = NativeBlock();
+    }
+    _codeUsed = 0;
+}
+
+Jit::NativeStats const & Jit::getNativeStats() const
+{
+    return _nativeStats;
+}
+
+void Jit::removeBlock(uint16_t startPc)
+{
+    _nativeBlocks[startPc] = NativeBlock();
+    BlockCache::removeBlock(startPc);
+}
+
+int Jit::runNative(Block const & block, NativeCode code, int budget)
+{
+    _runningBlock = &block;
+    _isRunningBlockRemoved = false;
+    _runningLength = static_cast<int>(block.microOps.size());
+    _runningBudget = budget;
+    _syncedCycles = 0;
+    _nativeStats.nativeRuns++;
+    uint32_t result = code(&_registers, this, budget);
+    int cycles = result & 0xffff;
+    sync(cycles);
+    _stats.instructions += result >> 16;
+    _runningBlock = nullptr;
+    return cycles;
+}
+
+Jit::NativeCode Jit::compile(Block const & block)
+{
+#ifdef GB_JIT_X86_64
+    size_t length = block.microOps.size();
+    if (_code == nullptr) {
+        return nullptr;
+    }
+    //generous upper bound, the longest opCode sequence is well under 100 bytes
+    size_t const maxCodeSize = 48 + 128 * length;
+    if (_codeUsed + maxCodeSize > _codeSize) {
+        for (auto& nativeBlock : _nativeBlocks) {
+            nativeBlock = NativeBlock();
+        }
+        _codeUsed = 0;
+        _nativeStats.codeFlushes++;
+    }
+    //only the pages the block may take, no native code runs while compiling
+    uint8_t* pages = _code + (_codeUsed & ~(_pageSize - 1));
+    size_t pagesSize = _code + _codeUsed + maxCodeSize - pages;
+    mprotect(pages, pagesSize, PROT_READ | PROT_WRITE);
+
+    Emitter emitter(_code + _codeUsed);
+    std::vector<uint8_t*> exits;
+    emitter.prologue();
+    int cyclesBefore = 0;
+    bool isEndEmitted = false;
+    for (size_t index = 0; index < length; index++) {
+        MicroOp const & microOp = block.microOps[index];
+        uint8_t opCode = microOp.opCode;
+        uint16_t nextPc = microOp.pc + Interpreter::getInstructionLength(opCode);
+        uint8_t destination = registerOffsets[(opCode >> 3) & 0x07];
+        uint8_t source = registerOffsets[opCode & 0x07];
+        bool isLast = index + 1 == length;
+        int cycles = 0;
+        //set with esi and edx when the instruction ends with a write
+        bool isWrite = false;
+        if (index > 0) {
+            exits.push_back(emitter.jumpIfOverBudget(cyclesBefore + Interpreter::getMaxCycles(opCode),
+                                                     microOp.pc, getResult(index, cyclesBefore)));
+        }
+
+        if (opCode == 0x00) {
+            cycles = 4;
+        }
+        else if ((opCode & 0xCF) == 0x01) {
+            emitter.storeWord(wordOffsets[opCode >> 4], microOp.operand);
+            cycles = 12;
+        }
+        else if ((opCode & 0xC7) == 0x03) {
+            emitter.incDecWord(wordOffsets[(opCode >> 4) & 0x03], (opCode & 0x08) == 0);
+            cycles = 8;
+        }
+        else if (((opCode & 0xC7) == 0x04 || (opCode & 0xC7) == 0x05) && opCode != 0x34 && opCode != 0x35) {
+            bool isIncrement = (opCode & 0x07) == 0x04;
+            emitter.incDecByte(destination, isIncrement);
+            emitter.saveFlags();
+            emitter.flagsToAl(0xA0, isIncrement ? 0x00 : 0x40);
+            emitter.mergeFlags(0x10);
+            cycles = 4;
+        }
+        else if (opCode == 0x36) {
+            emitter.moveToEsi(microOp.operand);
+            emitter.loadWordToEdx(HL);
+            isWrite = true;
+            cycles = 12;
+        }
+        else if ((opCode & 0xC7) == 0x06) {
+            emitter.storeByte(destination, static_cast<uint8_t>(microOp.operand));
+            cycles = 8;
+        }
+        else if (opCode == 0x02 || opCode == 0x12 || opCode == 0x22 || opCode == 0x32) {
+            emitter.loadByteToEsi(A);
+            emitter.loadWordToEdx(wordOffsets[opCode >> 4 == 3 ? 2 : opCode >> 4]);
+            if (opCode == 0x22 || opCode == 0x32) {
+                emitter.incDecWord(HL, opCode == 0x22);
+            }
+            isWrite = true;
+            cycles = 8;
+        }
+        else if (opCode == 0x0A || opCode == 0x1A || opCode == 0x2A || opCode == 0x3A) {
+            emitter.loadWordToEsi(wordOffsets[opCode >> 4 == 3 ? 2 : opCode >> 4]);
+            if (opCode == 0x2A || opCode == 0x3A) {
+                emitter.incDecWord(HL, opCode == 0x2A);
+            }
+            emitter.moveToEdx(cyclesBefore);
+            emitter.call(&Jit::readCallback);
+            emitter.storeAl(A);
+            cycles = 8;
+        }
+        else if (0x70 <= opCode && opCode <= 0x77 && opCode != 0x76) {
+            emitter.loadByteToEsi(source);
+            emitter.loadWordToEdx(HL);
+            isWrite = true;
+            cycles = 8;
+        }
+        else if (0x40 <= opCode && opCode <= 0x7F && opCode != 0x76 && (opCode & 0x07) == 0x06) {
+            emitter.loadWordToEsi(HL);
+            emitter.moveToEdx(cyclesBefore);
+            emitter.call(&Jit::readCallback);
+            emitter.storeAl(destination);
+            cycles = 8;
+        }
+        else if (0x40 <= opCode && opCode <= 0x7F && opCode != 0x76) {
+            emitter.loadByteToAl(source);
+            emitter.storeAl(destination);
+            cycles = 4;
+        }
+        else if (isAluOnA(opCode)) {
+            int operation = (opCode >> 3) & 0x07;
+            if ((opCode & 0xC7) == 0xC6) {
+                emitter.loadByteToAl(A);
+                if (operation == 1 || operation == 3) {
+                    emitter.loadCarry();
+                }
+                emitter.aluAlImmediate(operation, static_cast<uint8_t>(microOp.operand));
+                cycles = 8;
+            }
+            else if ((opCode & 0x07) == 0x06) {
+                emitter.loadWordToEsi(HL);
+                emitter.moveToEdx(cyclesBefore);
+                emitter.call(&Jit::readCallback);
+                emitter.moveEaxToEcx();
+                emitter.loadByteToAl(A);
+                if (operation == 1 || operation == 3) {
+                    emitter.loadCarry();
+                }
+                emitter.aluAlCl(operation);
+                cycles = 8;
+            }
+            else {
+                emitter.loadByteToAl(A);
+                if (operation == 1 || operation == 3) {
+                    emitter.loadCarry();
+                }
+                emitter.aluAl(operation, source);
+                cycles = 4;
+            }
+            emitter.saveFlags();
+            if (operation != 7) {
+                emitter.storeAl(A);
+            }
+            emitAluFlags(emitter, operation);
+        }
+        else if (opCode == 0xE0 || opCode == 0xEA || opCode == 0xE2) {
+            emitter.loadByteToEsi(A);
+            if (opCode == 0xE2) {
+                emitter.loadByteToEdx(registerOffsets[1]);
+                emitter.addToEdx(0xff00);
+            }
+            else {
+                emitter.moveToEdx(opCode == 0xE0 ? 0xff00 + microOp.operand : microOp.operand);
+            }
+            isWrite = true;
+            cycles = opCode == 0xEA ? 16 : (opCode == 0xE0 ? 12 : 8);
+        }
+        else if (opCode == 0xF0 || opCode == 0xFA || opCode == 0xF2) {
+            if (opCode == 0xF2) {
+                emitter.loadByteToEsi(registerOffsets[1]);
+                emitter.addToEsi(0xff00);
+            }
+            else {
+                emitter.moveToEsi(opCode == 0xF0 ? 0xff00 + microOp.operand : microOp.operand);
+            }
+            emitter.moveToEdx(cyclesBefore);
+            emitter.call(&Jit::readCallback);
+            emitter.storeAl(A);
+            cycles = opCode == 0xFA ? 16 : (opCode == 0xF0 ? 12 : 8);
+        }
+        else if (opCode == 0x18 || opCode == 0xC3) {
+            //the branches end their block
+            uint16_t target = opCode == 0x18
+                ? nextPc + static_cast<int8_t>(microOp.operand) : microOp.operand;
+            emitter.storeWord(PC, target);
+            emitter.moveToEax(getResult(index + 1, cyclesBefore + (opCode == 0x18 ? 12 : 16)));
+            isEndEmitted = true;
+        }
+        else if ((opCode & 0xE7) == 0x20 || (opCode & 0xE7) == 0xC2) {
+            //NZ Z NC C
+            int condition = (opCode >> 3) & 0x03;
+            bool isRelative = opCode < 0x40;
+            uint16_t target = isRelative
+                ? nextPc + static_cast<int8_t>(microOp.operand) : microOp.operand;
+            emitter.branchIf(condition < 2 ? 0x80 : 0x10, (condition & 0x01) != 0,
+                             nextPc, getResult(index + 1, cyclesBefore + (isRelative ? 8 : 12)),
+                             target, getResult(index + 1, cyclesBefore + (isRelative ? 12 : 16)));
+            isEndEmitted = true;
+        }
+        else {
+            //PC on the instruction, the Interpreter moves it
+            emitter.storeWord(PC, microOp.pc);
+            emitter.moveToEsi(opCode);
+            emitter.moveToEdx(microOp.operand);
+            emitter.moveToEcx(cyclesBefore);
+            emitter.moveToR8d(index);
+            cycles = opCode == 0xCB ? getPrefixedCycles(static_cast<uint8_t>(microOp.operand))
+                : Interpreter::getMaxCycles(opCode);
+            emitter.moveToR9d(cycles);
+            emitter.call(&Jit::executeCallback);
+            //the last one always leaves with the result of the block
+            if (isLast) {
+                isEndEmitted = true;
+            }
+            else {
+                exits.push_back(emitter.jumpIfNotZero());
+            }
+        }
+
+        if (isWrite) {
+            //PC past the write, the events the write woke may run right after it
+            emitter.storeWord(PC, nextPc);
+            emitter.moveToEcx(cyclesBefore);
+            emitter.moveToR8d(cycles);
+            emitter.moveToR9d(index);
+            emitter.call(&Jit::writeCallback);
+            exits.push_back(emitter.jumpIfNotZero());
+        }
+        cyclesBefore += cycles;
+        if (isLast && !isEndEmitted) {
+            emitter.storeWord(PC, nextPc);
+            emitter.moveToEax(getResult(length, cyclesBefore));
+        }
+    }
+    for (uint8_t* exit : exits) {
+        emitter.patch(exit, emitter.cursor());
+    }
+    emitter.epilogue();
+
+    mprotect(pages, pagesSize, PROT_READ | PROT_EXEC);
+    NativeCode code = reinterpret_cast<NativeCode>(_code + _codeUsed);
+    _codeUsed += (emitter.size() + 15) & ~size_t(15);
+    _nativeStats.compiledBlocks++;
+    return code;
+#else
+    (void)block;
+    return nullptr;
+#endif
+}
+
+void Jit::sync(int cycles)
+{
+    if (cycles != _syncedCycles) {
+        _scheduler->update(cycles - _syncedCycles);
+        _syncedCycles = cycles;
+    }
+}
+
+//a woken component is due before the event the native code checks for
+uint32_t Jit::leaveIfNeeded(int cycles, int index, bool isLeaving)
+{
+    if (!isLeaving && !_isRunningBlockRemoved
+        && _scheduler->getCyclesToNextEvent() >= _runningBudget - _syncedCycles) {
+        return 0;
+    }
+    return getResult(index + 1, cycles);
+}
+
+//the code after it counted on cycles, a conditional CALL or RET
+//not taken runs fewer and the block is left there too
+uint32_t Jit::executeCallback(Jit* jit, int opCode, int operand, int cyclesBefore, int index, int cycles)
+{
+    jit->sync(cyclesBefore);
+    uint16_t nextPc = jit->_registers.pc + Interpreter::getInstructionLength(opCode);
+    int runCycles = jit->_interpreter.execute(opCode, operand);
+    return jit->leaveIfNeeded(cyclesBefore + runCycles, index,
+                              index + 1 == jit->_runningLength || jit->_registers.pc != nextPc
+                              || runCycles != cycles);
+}
+
+//only the IO registers see the master clock
+int Jit::readCallback(Jit* jit, int adress, int cyclesBefore)
+{
+    if (adress >= 0xff00) {
+        jit->sync(cyclesBefore);
+    }
+    return jit->_memory.readInMemory(adress);
+}
+
+uint32_t Jit::writeCallback(Jit* jit, int data, int adress, int cyclesBefore, int cycles, int index)
+{
+    if (adress < 0xff00) {
+        jit->_memory.writeInMemory(data, adress);
+        return jit->_isRunningBlockRemoved ? jit->leaveIfNeeded(cyclesBefore + cycles, index, true) : 0;
+    }
+    jit->sync(cyclesBefore);
+    jit->_memory.writeInMemory(data, adress);
+    return jit->leaveIfNeeded(cyclesBefore + cycles, index, false);
+}
@@ -16,6 +16,7 @@ MainWindow::MainWindow(QWidget *parent, MyCanvas& canvas) :
   _fileIO.reset(nullptr);
   _romLoader.reset(nullptr);
   _cpu.reset(nullptr);
+  _qtCpu.reset(nullptr);
 
   _nextButton = this->findChild<QPushButton*>("nextButton");
   assert(_nextButton != nullptr);
@@ -75,8 +76,10 @@ void MainWindow::on_actionNormal_triggered()
 
     _fileIO.reset(new FileIO);
     _romLoader.reset(new RomLoader(*_fileIO));
-    _cpu.reset(new Cpu(*_romLoader));
-    connect(_cpu.get(), SIGNAL(screen_refresh()), this, SLOT(renderScreen()));
+    _qtCpu.reset(nullptr);
+    _cpu.reset(new Cpu(*_romLoader, Cpu::CORE::INTERPRETER));
+    _qtCpu.reset(new QtCpu(*_cpu));
+    connect(_qtCpu.get(), SIGNAL(screen_refresh()), this, SLOT(renderScreen()));
 
     if (!_cpu->launchGame(loadedRom)) {
         BOOST_LOG_TRIVIAL(debug) << "Failed to load : " << loadedRom;
@@ -98,6 +101,7 @@ void MainWindow::on_actionDebug_mode_triggered()
 
     _fileIO.reset(new FileIO);
     _romLoader.reset(new RomLoader(*_fileIO));
+    _qtCpu.reset(nullptr);
     _cpu.reset(new Cpu(*_romLoader));
     if (!_cpu->launchGameDebug(loadedRom)) {
         BOOST_LOG_TRIVIAL(debug) << "Failed to load : " << loadedRom;
@@ -113,6 +117,7 @@ void MainWindow::on_actionDebug_mode_triggered()
 void MainWindow::on_actionStop_triggered()
 {
     BOOST_LOG_TRIVIAL(debug) << "Stopping Gameboy";
+    _qtCpu.reset(nullptr);
     _cpu.reset(nullptr);
     _romLoader.reset(nullptr);
     _fileIO.reset(nullptr);
@@ -124,7 +129,8 @@ void MainWindow::on_actionStop_triggered()
 void MainWindow::createMemoryTable()
 {
     _previousPcValueCell = {0, 0};
-    auto rom = _cpu->getState().readOnlyMemory;
+    _cpu->copyMemory(_memorySnapshot);
+    IMemory::RomData const & rom = _memorySnapshot;
     int const rowSize = rom.size() / 16;
     _memoryTable->setRowCount(rowSize);
 
@@ -154,7 +160,8 @@ void MainWindow::createMemoryTable()
 }
 void MainWindow::updateMemoryTable()
 {
-    auto rom = _cpu->getState().readOnlyMemory;
+    _cpu->copyMemory(_memorySnapshot);
+    IMemory::RomData const & rom = _memorySnapshot;
     for (size_t i = 0; i < rom.size(); i++) {
         QString hexVal = QString("%1").arg(rom[i], 2, 16, QChar('0'));
 
@@ -207,14 +214,14 @@ void MainWindow::updateState()
     }
     _dataFetchFocus.clear();
     _memoryTable->item(_previousPcValueCell.row, _previousPcValueCell.col)->setBackground(Qt::white);
-    auto state =_cpu->getState();
+    uint16_t const pcValue = _cpu->getRegisterState().registers.pc;
 
     QListWidgetItem* newItem = new QListWidgetItem(_cpu->getReadableInstruction().c_str());
     _historyList->addItem(newItem);
     _historyList->scrollToItem(newItem);
 
-    int const row = state.pcValue / 16;
-    int const col = state.pcValue % 16;
+    int const row = pcValue / 16;
+    int const col = pcValue % 16;
     _previousPcValueCell = {row, col};
     _memoryTable->item(row, col)->setBackground(Qt::cyan);
     _memoryTable->scrollToItem(_memoryTable->item(row, col));
@@ -235,8 +242,7 @@ void MainWindow::continueUntilOpCodeBreakpoint(unsigned int opCode)
     std::vector<std::string> instructions;
     while (i < 100000) {
         _cpu->updateDebug();
-        auto state =_cpu->getState();
-        if (opCode == state.opCode) {
+        if (opCode == _cpu->getRegisterState().opCode) {
             break ;
         }
         instructions.push_back(_cpu->getReadableInstruction());
@@ -305,8 +311,8 @@ void MainWindow::on_focusAdressButton_clicked()
 
 void MainWindow::on_focusPcButton_clicked()
 {
-    auto state =_cpu->getState();
-    int const row = state.pcValue / 16;
-    int const col = state.pcValue % 16;
+    uint16_t const pcValue = _cpu->getRegisterState().registers.pc;
+    int const row = pcValue / 16;
+    int const col = pcValue % 16;
     _memoryTable->scrollToItem(_memoryTable->item(row, col));
 }
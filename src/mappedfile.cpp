@@ -0,0 +1,72 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "mappedfile.hpp"
+
+MappedFile::~MappedFile()
+{
+    if (_data != nullptr) {
+        munmap(_data, _size);
+    }
+}
+
+bool MappedFile::map(int fd)
+{
+    struct stat status;
+    if (_data != nullptr || fstat(fd, &status) != 0 || status.st_size <= 0) {
+        return false;
+    }
+    void* data = mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    _data = static_cast<uint8_t*>(data);
+    _size = status.st_size;
+    return true;
+}
+
+bool MappedFile::mapWritable(int fd, size_t size)
+{
+    struct stat status;
+    if (_data != nullptr || size == 0 || fstat(fd, &status) != 0) {
+        return false;
+    }
+    if (static_cast<size_t>(status.st_size) < size && ftruncate(fd, size) != 0) {
+        return false;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    _data = static_cast<uint8_t*>(data);
+    _size = size;
+    _isWritable = true;
+    return true;
+}
+
+uint8_t const * MappedFile::getData() const
+{
+    return _data;
+}
+
+uint8_t* MappedFile::getWritableData()
+{
+    return _isWritable ? _data : nullptr;
+}
+
+size_t MappedFile::getSize() const
+{
+    return _size;
+}
+
+//msync wants the offset on a page boundary
+bool MappedFile::sync(size_t offset, size_t size)
+{
+    if (!_isWritable || offset >= _size) {
+        return false;
+    }
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    size_t start = offset / pageSize * pageSize;
+    size_t end = offset + size < _size ? offset + size : _size;
+    return msync(_data + start, end - start, MS_SYNC) == 0;
+}
@@ -1,6 +1,5 @@
 #include <algorithm>
 #include <iostream>
-#include <bitset>
 #include "memory.hpp"
 #include "itimer.hpp"
 
@@ -9,45 +8,118 @@ Memory::Memory()
     reset();
 }
 
-void Memory::setTimer(ITimer* timer)
+void Memory::setIoHandler(uint16_t adress, IIoHandler* handler)
 {
-    _timer = timer;
+    if (adress < 0xff00 || adress > 0xff7f) {
+        throw MemoryException(__PRETTY_FUNCTION__);
+    }
+    _ioHandlers[adress & 0x7f] = handler;
 }
 
-void Memory::incrementDividerRegister()
+void Memory::setCodeCache(ICodeCache* codeCache)
 {
-    _readOnlyMemory[_timer->_DIV]++;
+    _codeCache = codeCache;
 }
 
-void Memory::incrementScanline()
+void Memory::setScheduler(IScheduler* scheduler)
 {
-    _readOnlyMemory[0xff44]++;
+    _scheduler = scheduler;
 }
-IMemory::CartridgeData const Memory::getCartridge()
+
+//called before the write, the timer counts with the former controler
+void Memory::wakeScheduler(uint8_t data, uint16_t adress)
 {
-    return _cartridge;
+    switch (adress) {
+    case ITimer::_TMC:
+        _scheduler->wake(IScheduler::EVENT::TIMER);
+        break;
+    case 0xff0f:
+        if (_readOnlyMemory[adress] != data) {
+            _scheduler->wake(IScheduler::EVENT::SCANLINE);
+            _scheduler->wake(IScheduler::EVENT::INTERRUPT);
+        }
+        break;
+    case 0xffff:
+        if (_readOnlyMemory[adress] != data) {
+            _scheduler->wake(IScheduler::EVENT::INTERRUPT);
+        }
+        break;
+    case 0xff44:
+        //any write resets the scanline
+        if (_readOnlyMemory[adress] != 0) {
+            _scheduler->wake(IScheduler::EVENT::SCANLINE);
+        }
+        break;
+    case 0xff40:
+    case 0xff41:
+    case 0xff45:
+        if (_readOnlyMemory[adress] != data) {
+            _scheduler->wake(IScheduler::EVENT::SCANLINE);
+        }
+        break;
+    }
+}
+
+Registers& Memory::getRegisters()
+{
+    materializeFlags();
+    return _registers;
+}
+
+void Memory::setLazyFlags(bool isLazy)
+{
+    materializeFlags();
+    _isLazyFlags = isLazy;
 }
 
-IMemory::RomData const Memory::getReadOnlyMemory()
+void Memory::incrementScanline()
+{
+    _readOnlyMemory[0xff44]++;
+}
+IMemory::CartridgeData const & Memory::getCartridge()
 {
-    return _readOnlyMemory;
+    return _cartridge;
 }
 
 template<class ARRAY>
 bool Memory::isEmpty(ARRAY const & memory)
 {
     return std::all_of(std::begin(memory), std::end(memory),
-                       []( typename ARRAY::value_type const & elem)
+                       []( uint8_t const & elem)
                        { return elem == 0; }
                        );
 }
 
+//read by the Memory without a game, shared by all of them
+CartridgeData const & Memory::getBlankCartridge()
+{
+    static CartridgeData const blankCartridge(std::vector<uint8_t>(readOnlyBankSize, 0x0));
+    return blankCartridge;
+}
+
 bool Memory::setCartridge(IMemory::CartridgeData const & cartridge)
 {
     if (!isEmpty(cartridge) && reset()) {
         _cartridge = cartridge;
-        fillROM();
+        //the pages map whole banks, a shorter rom gets copied with padding
+        size_t romBankSize = MemoryBankController::romBankSize;
+        if (_cartridge.size() < readOnlyBankSize || _cartridge.size() % romBankSize != 0) {
+            size_t size = (_cartridge.size() + romBankSize - 1) / romBankSize * romBankSize;
+            std::vector<uint8_t> padded(size < readOnlyBankSize ? readOnlyBankSize : size, 0x0);
+            std::copy(_cartridge.begin(), _cartridge.end(), padded.begin());
+            _cartridge = CartridgeData(std::move(padded));
+        }
+        MemoryBankController::TYPE type = MemoryBankController::getType(_cartridge[0x147]);
+        size_t romBanks = std::min(MemoryBankController::getRomBanks(_cartridge[0x148]),
+                                   _cartridge.size() / romBankSize);
+        _bankController = MemoryBankController(type, romBanks,
+                                               MemoryBankController::getRamBanks(_cartridge[0x149]));
+        _externalRam.assign(_bankController.getRamSize(), 0x0);
+        mapPages();
         initializeMemory();
+        if (_codeCache != nullptr) {
+            _codeCache->clear();
+        }
         return true;
     }
     return false;
@@ -72,7 +144,56 @@ IMemory::State Memory::getState()
 
     state.reg16Bit.push_back({"IE", _readOnlyMemory[0xffff]});
     state.reg16Bit.push_back({"IF", _readOnlyMemory[0xff0f]});
-    state.readOnlyMemory = _readOnlyMemory;
+    state.readOnlyMemory = getReadOnlyMemory();
+    return state;
+}
+
+void Memory::copyMemory(RomData& snapshot)
+{
+    for (size_t page = 0; page < _readPages.size(); page++) {
+        size_t adress = page << 8;
+        if (_readPages[page] != nullptr) {
+            std::copy(_readPages[page], _readPages[page] + 0x100, &snapshot[adress]);
+        }
+        else {
+            for (size_t index = adress; index < adress + 0x100; index++) {
+                snapshot[index] = readInMemory(index);
+            }
+        }
+    }
+}
+
+size_t Memory::getBatteryRamSize() const
+{
+    return MemoryBankController::hasBattery(_cartridge[0x147]) ? _bankController.getRamSize() : 0;
+}
+
+bool Memory::setSaveFile(std::shared_ptr<SaveFile> saveFile)
+{
+    size_t size = getBatteryRamSize();
+    if (saveFile == nullptr || size == 0 || saveFile->getSize() < size) {
+        return false;
+    }
+    _saveFile = std::move(saveFile);
+    mapPages();
+    if (_codeCache != nullptr) {
+        _codeCache->clear();
+    }
+    return true;
+}
+
+uint8_t* Memory::getExternalRam()
+{
+    return _saveFile != nullptr ? _saveFile->getData() : _externalRam.data();
+}
+
+IMemory::RegisterState Memory::getRegisterState()
+{
+    RegisterState state;
+    state.registers = getRegisters();
+    state.opCode = readInMemory(_registers.pc);
+    state.interruptEnable = _readOnlyMemory[0xffff];
+    state.interruptRequest = _readOnlyMemory[0xff0f];
     return state;
 }
 void Memory::initializeMemory()
@@ -120,42 +241,106 @@ void Memory::initializeMemory()
 
 bool Memory::writeInMemory(uint8_t data, uint16_t adress)
 {
-    //read only memory
-    if (adress < 0x8000) {
-        //TODO
-        // writes a byte to memory. Remember that address 0 - 07FFF is rom so we cant write to this address
-        // writing to memory address 0x0 to 0x1FFF this disables writing to the ram bank. 0 disables, 0xA enables
-        // if writing to a memory address between 2000 and 3FFF then we need to change rom bank
-        // writing to address 0x4000 to 0x5FFF switches ram banks (if enabled of course)
-        // writing to address 0x6000 to 0x7FFF switches memory model
-        return false;
+    //the rom only changes through switchBanks
+    if (_codeCache != nullptr && adress >= 0x8000) {
+        invalidateCode(adress);
+        //echo ram is the work ram seen 0x2000 higher
+        if (0xc000 <= adress && adress <= 0xddff) {
+            invalidateCode(adress + 0x2000);
+        }
+        else if (0xe000 <= adress && adress <= 0xfdff) {
+            invalidateCode(adress - 0x2000);
+        }
     }
-    else if (0xc000 <= adress && adress <= 0xdfff) {
-        _readOnlyMemory[adress] = data;
+    uint8_t* page = _writePages[adress >> 8];
+    if (page != nullptr) {
+        page[adress & 0xff] = data;
+        return true;
     }
-    //write to echo ram also write in ram
-    else if (0xe000 <= adress && adress <= 0xfdff) {
+    //hram, no handler nor scheduler to tell
+    if (adress >= 0xff80 && adress != 0xffff) {
         _readOnlyMemory[adress] = data;
-        writeInMemory(data, adress - 0x2000);
+        return true;
     }
-    //TODO restricted area
-    else if (0xfea0 <= adress && adress <= 0xfeff){}
-    else if (adress == _timer->_DIV) {
-        _readOnlyMemory[_timer->_DIV] = 0;
+    return writeSlow(data, adress);
+}
+
+void Memory::invalidateCode(uint16_t adress)
+{
+    if (_codeCache->isCode(adress)) {
+        _codeCache->invalidate(adress);
+    }
+}
+
+void Memory::invalidateCode(uint16_t adress, size_t size)
+{
+    for (size_t index = adress; index < adress + size; index++) {
+        invalidateCode(index);
+    }
+}
+
+void Memory::switchBanks()
+{
+    uint8_t const * romBank0 = _readPages[0x00];
+    uint8_t const * romBank = _readPages[0x40];
+    uint8_t const * ramBank = _readPages[0xa0];
+    mapPages();
+    if (_codeCache == nullptr) {
+        return;
+    }
+    if (romBank0 != _readPages[0x00]) {
+        invalidateCode(0x0000, MemoryBankController::romBankSize);
+    }
+    if (romBank != _readPages[0x40]) {
+        invalidateCode(0x4000, MemoryBankController::romBankSize);
+    }
+    if (ramBank != _readPages[0xa0]) {
+        invalidateCode(0xa000, MemoryBankController::ramBankSize);
+    }
+}
+
+//cartridge ram and io registers
+uint8_t Memory::readSlow(uint16_t adress)
+{
+    if (0xa000 <= adress && adress <= 0xbfff) {
+        return _bankController.isClockMapped() ? _bankController.readClock() : 0xff;
+    }
+    if (0xff00 <= adress && adress <= 0xff7f && _ioHandlers[adress & 0x7f] != nullptr) {
+        return _ioHandlers[adress & 0x7f]->readIo(adress, _readOnlyMemory[adress]);
+    }
+    return _readOnlyMemory[adress];
+}
+
+//rom, cartridge ram, oam and io pages
+bool Memory::writeSlow(uint8_t data, uint16_t adress)
+{
+    if (_scheduler != nullptr && adress >= 0xff00) {
+        wakeScheduler(data, adress);
     }
-    else if (adress == _timer->_TMC) {
-        int currentFrequency = _timer->getClockFrequency();
-        _readOnlyMemory[_timer->_TMC] = data;
-        int newFrequency = _timer->getClockFrequency();
-        if(currentFrequency != newFrequency) {
-            _timer->setClockFrequency();
+    //the rom is not written, its bank controller is
+    if (adress < 0x8000) {
+        if (_bankController.write(data, adress)) {
+            switchBanks();
         }
+        return false;
     }
-    else if (adress == 0xff44) {
-        _readOnlyMemory[0xff44] = 0;
+    //disabled ram ignores the writes
+    else if (0xa000 <= adress && adress <= 0xbfff) {
+        if (_bankController.isClockMapped()) {
+            _bankController.writeClock(data);
+        }
+        //the page written goes to the file with the next flush
+        else if (_saveFile != nullptr && _bankController.isRamMapped()) {
+            size_t offset = _bankController.getRamBank() * MemoryBankController::ramBankSize
+                + adress - 0xa000;
+            _saveFile->getData()[offset] = data;
+            _saveFile->markDirty(offset);
+        }
     }
-    else if (adress == 0xff46) {
-        dmaTransfer(data);
+    //TODO restricted area
+    else if (0xfea0 <= adress && adress <= 0xfeff){}
+    else if (0xff00 <= adress && adress <= 0xff7f && _ioHandlers[adress & 0x7f] != nullptr) {
+        _readOnlyMemory[adress] = _ioHandlers[adress & 0x7f]->writeIo(adress, data, _readOnlyMemory[adress]);
     }
     else if (0xff4c <= adress && adress <= 0xff7f){}
 
@@ -165,69 +350,74 @@ bool Memory::writeInMemory(uint8_t data, uint16_t adress)
     return true;
 }
 
-uint8_t Memory::readInMemory(uint16_t adress)
-{
-    //TODO
-    return _readOnlyMemory[adress];
-}
-
-bool Memory::fillROM()
+//the banks from the controller, the echo ram on the work ram,
+//the io page has no pointer, readInMemory and writeInMemory serve its
+//hram and leave the io registers and IE to readSlow and writeSlow
+void Memory::mapPages()
 {
-    std::copy(_cartridge.begin(),
-              _cartridge.begin() + IMemory::readOnlyBankSize,
-              _readOnlyMemory.begin());
-    return !isEmpty(_readOnlyMemory);
+    size_t romBank0 = _bankController.getRomBank0() * MemoryBankController::romBankSize;
+    size_t romBank = _bankController.getRomBank() * MemoryBankController::romBankSize;
+    size_t ramBank = _bankController.getRamBank() * MemoryBankController::ramBankSize;
+    bool isRamMapped = _bankController.isRamMapped();
+    for (size_t page = 0; page < _readPages.size(); page++) {
+        size_t adress = page << 8;
+        if (adress < 0x4000) {
+            _readPages[page] = _cartridge.data() + romBank0 + adress;
+            _writePages[page] = nullptr;
+        }
+        else if (adress < readOnlyBankSize) {
+            _readPages[page] = _cartridge.data() + romBank + adress - 0x4000;
+            _writePages[page] = nullptr;
+        }
+        else if (0xa000 <= adress && adress <= 0xbfff) {
+            uint8_t* ram = isRamMapped ? getExternalRam() + ramBank + adress - 0xa000 : nullptr;
+            _readPages[page] = ram;
+            //the save file is told about each write
+            _writePages[page] = _saveFile == nullptr ? ram : nullptr;
+        }
+        else if (0xe000 <= adress && adress <= 0xfdff) {
+            _readPages[page] = &_readOnlyMemory[adress - 0x2000];
+            _writePages[page] = &_readOnlyMemory[adress - 0x2000];
+        }
+        else {
+            _readPages[page] = adress < 0xff00 ? &_readOnlyMemory[adress] : nullptr;
+            _writePages[page] = adress < 0xfe00 ? &_readOnlyMemory[adress] : nullptr;
+        }
+    }
 }
 
 bool Memory::reset()
 {
     _readOnlyMemory.fill(0x0);
-    _cartridge.fill(0x0);
+    _cartridge = getBlankCartridge();
     _registers.pc = 0x0000;
     _registers.sp = 0x0000;
     _registers.af = 0x0000;
     _registers.bc = 0x0000;
     _registers.de = 0x0000;
     _registers.hl = 0x0000;
+    _hasPendingFlags = false;
+    _bankController = MemoryBankController();
+    _externalRam.assign(_bankController.getRamSize(), 0x0);
+    _saveFile.reset();
+    mapPages();
     return true;
 }
 
 
-void Memory::set8BitRegister(REG8BIT reg,uint8_t value)
-{
-    *_8BitRegisters[reg] = value;
-}
-
-void Memory::set16BitRegister(REG16BIT reg,uint16_t value)
-{
-    *_16BitRegisters[reg] = value;
-}
-
-uint8_t Memory::get8BitRegister(REG8BIT reg)
-{
-    return *_8BitRegisters[reg];
-}
-
-uint16_t Memory::get16BitRegister(REG16BIT reg)
-{
-    return *_16BitRegisters[reg];
-}
-
-void Memory::setFlag(IMemory::FLAG flag)
+void Memory::setAluFlags(ALU_OPERATION operation, uint8_t value, uint8_t operand, bool carry)
 {
-    uint8_t regValue = *_8BitRegisters[IMemory::REG8BIT::F];
-    std::bitset<8> bitsetFlag(regValue);
-    bitsetFlag.set(static_cast<int>(flag));
-    // regValue = 1 << static_cast<int>(flag);
-    set8BitRegister(IMemory::REG8BIT::F, static_cast<uint8_t>(bitsetFlag.to_ulong()));
-}
-
-void Memory::unsetFlag(IMemory::FLAG flag)
-{
-    uint8_t regValue = *_8BitRegisters[IMemory::REG8BIT::F];
-    std::bitset<8> bitsetFlag(regValue);
-    bitsetFlag.reset(static_cast<int>(flag));
-    set8BitRegister(IMemory::REG8BIT::F, static_cast<uint8_t>(bitsetFlag.to_ulong()));
+    uint8_t mask = getAluFlagsMask(operation);
+    if (_isLazyFlags) {
+        //bits outside the mask still come from the previous operation
+        if (mask != 0xF0) {
+            materializeFlags();
+        }
+        _pendingFlags = {operation, value, operand, carry};
+        _hasPendingFlags = true;
+        return;
+    }
+    _registers.f = (_registers.f & ~mask) | computeAluFlags(operation, value, operand, carry);
 }
 
 void Memory::unsetBitInRegister(int bit, REG8BIT reg)
@@ -235,9 +425,7 @@ void Memory::unsetBitInRegister(int bit, REG8BIT reg)
     if (bit > 7) {
         throw MemoryException(__PRETTY_FUNCTION__);
     }
-    uint8_t regValue = *_8BitRegisters[reg];
-    regValue = 0 << bit;
-    set8BitRegister(reg, regValue);
+    set8BitRegister(reg, get8BitRegister(reg) & ~(1 << bit));
 }
 
 void Memory::setBitInRegister(int bit, REG8BIT reg)
@@ -245,20 +433,7 @@ void Memory::setBitInRegister(int bit, REG8BIT reg)
     if (bit > 7) {
         throw MemoryException(__PRETTY_FUNCTION__);
     }
-    uint8_t regValue = *_8BitRegisters[reg];
-    regValue = 1 << bit;
-    set8BitRegister(reg, regValue);
-}
-
-bool Memory::isSetFlag(FLAG flag)
-{
-    int flagValue = static_cast<int>(flag);
-    if (flagValue > 7) {
-        throw MemoryException(__PRETTY_FUNCTION__);
-    }
-    uint8_t regValue = *_8BitRegisters[REG8BIT::F];
-    std::bitset<8> bitset(regValue);
-    return bitset.test(flagValue);
+    set8BitRegister(reg, get8BitRegister(reg) | (1 << bit));
 }
 
 bool Memory::isSet(int bit, REG8BIT reg)
@@ -266,17 +441,5 @@ bool Memory::isSet(int bit, REG8BIT reg)
     if (bit > 7) {
         throw MemoryException(__PRETTY_FUNCTION__);
     }
-    uint16_t regValue = *_8BitRegisters[reg];
-    std::bitset<8> bitset(regValue);
-    return bitset.test(bit);
-
-}
-
-void Memory::dmaTransfer(uint8_t data)
-{
-    uint16_t adress = data << 8;
-    for(int i = 0; i < 0xA0; i++){
-        uint8_t toCopy = _readOnlyMemory[adress + i];
-        writeInMemory(toCopy, 0xfe00 + i);
-    }
+    return (get8BitRegister(reg) >> bit) & 0x01;
 }
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include "memorybankcontroller.hpp"
+
+MemoryBankController::TYPE MemoryBankController::getType(uint8_t cartridgeType)
+{
+    switch (cartridgeType) {
+    case 0x01: case 0x02: case 0x03:
+        return TYPE::MBC1;
+    case 0x0F: case 0x10: case 0x11: case 0x12: case 0x13:
+        return TYPE::MBC3;
+    case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E:
+        return TYPE::MBC5;
+    default:
+        //rom only, rom + ram and the controllers not supported yet
+        return TYPE::NONE;
+    }
+}
+
+size_t MemoryBankController::getRomBanks(uint8_t romSize)
+{
+    return romSize <= 0x08 ? 2 << romSize : 2;
+}
+
+size_t MemoryBankController::getRamBanks(uint8_t ramSize)
+{
+    static size_t const banks[] = {0, 1, 1, 4, 16, 8};
+    return ramSize < 6 ? banks[ramSize] : 0;
+}
+
+bool MemoryBankController::hasBattery(uint8_t cartridgeType)
+{
+    switch (cartridgeType) {
+    case 0x03: case 0x09: case 0x0F: case 0x10: case 0x13: case 0x1B: case 0x1E:
+        return true;
+    default:
+        return false;
+    }
+}
+
+//without a controller the ram, if any, is always there.
+//The clock starts at 0 with the cartridge
+MemoryBankController::MemoryBankController(TYPE type, size_t romBanks, size_t ramBanks)
+    :_type(type),
+     _romBanks(std::max<size_t>(romBanks, 2)),
+     _ramBanks(type == TYPE::NONE ? 1 : ramBanks),
+     _isRamEnabled(type == TYPE::NONE)
+{
+    setClockSeconds(0);
+}
+
+bool MemoryBankController::write(uint8_t data, uint16_t adress)
+{
+    size_t romBank0 = getRomBank0();
+    size_t romBank = getRomBank();
+    size_t ramBank = getRamBank();
+    bool isRamMapped = this->isRamMapped();
+
+    if (_type == TYPE::NONE) {
+        return false;
+    }
+    else if (adress < 0x2000) {
+        _isRamEnabled = (data & 0x0F) == 0x0A;
+    }
+    else if (_type == TYPE::MBC1) {
+        if (adress < 0x4000) {
+            //bank 0 is read as bank 1, the upper bits are not checked
+            _romBank = std::max(data & 0x1F, 1);
+        }
+        else if (adress < 0x6000) {
+            _ramBank = data & 0x03;
+        }
+        else {
+            _isAdvancedMode = data & 0x01;
+        }
+    }
+    else if (_type == TYPE::MBC3) {
+        if (adress < 0x4000) {
+            _romBank = std::max(data & 0x7F, 1);
+        }
+        else if (adress < 0x6000) {
+            _ramBank = data & 0x0F;
+        }
+        else {
+            //0 then 1 copies the clock into the registers read
+            if (_latch == 0x00 && data == 0x01) {
+                _latchedClock = getClockRegisters();
+            }
+            _latch = data;
+        }
+    }
+    else {
+        if (adress < 0x3000) {
+            _romBank = (_romBank & 0x100) | data;
+        }
+        else if (adress < 0x4000) {
+            _romBank = (_romBank & 0xFF) | ((data & 0x01) << 8);
+        }
+        else if (adress < 0x6000) {
+            _ramBank = data & 0x0F;
+        }
+    }
+    return romBank0 != getRomBank0()
+        || romBank != getRomBank()
+        || ramBank != getRamBank()
+        || isRamMapped != this->isRamMapped();
+}
+
+MemoryBankController::TYPE MemoryBankController::getType() const
+{
+    return _type;
+}
+
+size_t MemoryBankController::getRamSize() const
+{
+    return _ramBanks * ramBankSize;
+}
+
+//mbc1 maps the upper bits at 0x0000 as well in advanced mode
+size_t MemoryBankController::getRomBank0() const
+{
+    if (_type == TYPE::MBC1 && _isAdvancedMode) {
+        return (_ramBank << 5) % _romBanks;
+    }
+    return 0;
+}
+
+size_t MemoryBankController::getRomBank() const
+{
+    if (_type == TYPE::MBC1) {
+        return ((_ramBank << 5) | _romBank) % _romBanks;
+    }
+    return _romBank % _romBanks;
+}
+
+size_t MemoryBankController::getRamBank() const
+{
+    if (_ramBanks == 0 || _type == TYPE::NONE
+        || (_type == TYPE::MBC1 && !_isAdvancedMode)) {
+        return 0;
+    }
+    //mbc5 has 16 ram banks, mbc3 uses 0x08 and up for its clock
+    return (_ramBank & (_type == TYPE::MBC5 ? 0x0F : 0x07)) % _ramBanks;
+}
+
+bool MemoryBankController::isRamMapped() const
+{
+    return _isRamEnabled && _ramBanks != 0 && !isClockMapped();
+}
+
+bool MemoryBankController::isClockMapped() const
+{
+    return _type == TYPE::MBC3 && _isRamEnabled && _ramBank >= 0x08 && _ramBank <= 0x0C;
+}
+
+uint8_t MemoryBankController::readClock() const
+{
+    return _latchedClock[_ramBank - 0x08];
+}
+
+void MemoryBankController::writeClock(uint8_t data)
+{
+    std::array<uint8_t, 5> clock = getClockRegisters();
+    clock[_ramBank - 0x08] = data;
+    _latchedClock[_ramBank - 0x08] = data;
+    uint64_t days = clock[DAY_LOW] | ((clock[DAY_HIGH] & 0x01) << 8);
+    _isDayCarry = clock[DAY_HIGH] & 0x80;
+    _isClockHalted = clock[DAY_HIGH] & 0x40;
+    setClockSeconds((clock[SECONDS] & 0x3F)
+                    + (clock[MINUTES] & 0x3F) * 60
+                    + (clock[HOURS] & 0x1F) * 3600
+                    + days * 86400);
+}
+
+uint64_t MemoryBankController::getClockSeconds() const
+{
+    if (_isClockHalted) {
+        return _clockSeconds;
+    }
+    std::time_t now = std::time(nullptr);
+    return _clockSeconds + (now > _clockStart ? now - _clockStart : 0);
+}
+
+void MemoryBankController::setClockSeconds(uint64_t seconds)
+{
+    _clockSeconds = seconds;
+    _clockStart = std::time(nullptr);
+}
+
+//the day counter is 9 bits, the carry stays set once it overflowed
+std::array<uint8_t, 5> MemoryBankController::getClockRegisters() const
+{
+    uint64_t seconds = getClockSeconds();
+    uint64_t days = seconds / 86400;
+    std::array<uint8_t, 5> clock;
+    clock[SECONDS] = seconds % 60;
+    clock[MINUTES] = (seconds / 60) % 60;
+    clock[HOURS] = (seconds / 3600) % 24;
+    clock[DAY_LOW] = days & 0xFF;
+    clock[DAY_HIGH] = ((days >> 8) & 0x01)
+        | (_isClockHalted ? 0x40 : 0x00)
+        | (_isDayCarry || days > 0x1FF ? 0x80 : 0x00);
+    return clock;
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include "profiler.hpp"
+
+Profiler::Profiler()
+    :_pcHits(0x10000){}
+
+void Profiler::reset()
+{
+    _counters.fill(Counter());
+    _cbCounters.fill(Counter());
+    std::fill(_pcHits.begin(), _pcHits.end(), 0);
+}
+
+Profiler::Counter const & Profiler::getCounter(uint8_t opCode) const
+{
+    return _counters[opCode];
+}
+
+Profiler::Counter const & Profiler::getCbCounter(uint8_t opCode) const
+{
+    return _cbCounters[opCode];
+}
+
+uint64_t Profiler::getPcHits(uint16_t pc) const
+{
+    return _pcHits[pc];
+}
+
+Profiler::Counter Profiler::getTotal() const
+{
+    Counter total;
+    for (auto const * counters : {&_counters, &_cbCounters}) {
+        for (Counter const & counter : *counters) {
+            total.executions += counter.executions;
+            total.cycles += counter.cycles;
+        }
+    }
+    return total;
+}
+
+namespace
+{
+    std::string hex(int value, int width)
+    {
+        std::ostringstream stream;
+        stream << std::hex << std::uppercase << std::setfill('0') << std::setw(width) << value;
+        return stream.str();
+    }
+
+    double share(uint64_t cycles, uint64_t totalCycles)
+    {
+        return totalCycles == 0 ? 0.0 : 100.0 * cycles / totalCycles;
+    }
+}
+
+void Profiler::writeCsv(std::ostream& stream) const
+{
+    uint64_t totalCycles = getTotal().cycles;
+    stream << "kind,code,executions,cycles,share\n";
+    for (int opCode = 0; opCode < 0x100; opCode++) {
+        for (bool isCb : {false, true}) {
+            Counter const & counter = isCb ? _cbCounters[opCode] : _counters[opCode];
+            if (counter.executions != 0) {
+                stream << (isCb ? "cb," : "base,") << hex(opCode, 2) << ","
+                       << counter.executions << "," << counter.cycles << ","
+                       << share(counter.cycles, totalCycles) << "\n";
+            }
+        }
+    }
+    for (int pc = 0; pc < 0x10000; pc++) {
+        if (_pcHits[pc] != 0) {
+            stream << "pc," << hex(pc, 4) << "," << _pcHits[pc] << ",,\n";
+        }
+    }
+}
+
+void Profiler::writeJson(std::ostream& stream) const
+{
+    uint64_t totalCycles = getTotal().cycles;
+    auto writeCounters = [&](std::array<Counter, 0x100> const & counters) {
+        char const * separator = "";
+        stream << "{";
+        for (int opCode = 0; opCode < 0x100; opCode++) {
+            Counter const & counter = counters[opCode];
+            if (counter.executions != 0) {
+                stream << separator << "\n    \"" << hex(opCode, 2) << "\": {\"executions\": "
+                       << counter.executions << ", \"cycles\": " << counter.cycles
+                       << ", \"share\": " << share(counter.cycles, totalCycles) << "}";
+                separator = ",";
+            }
+        }
+        stream << "\n  }";
+    };
+    stream << "{\n  \"cycles\": " << totalCycles << ",\n  \"base\": ";
+    writeCounters(_counters);
+    stream << ",\n  \"cb\": ";
+    writeCounters(_cbCounters);
+    stream << ",\n  \"pc\": {";
+    char const * separator = "";
+    for (int pc = 0; pc < 0x10000; pc++) {
+        if (_pcHits[pc] != 0) {
+            stream << separator << "\n    \"" << hex(pc, 4) << "\": " << _pcHits[pc];
+            separator = ",";
+        }
+    }
+    stream << "\n  }\n}\n";
+}
+
+bool Profiler::dump(std::string const & fileName) const
+{
+    std::ofstream file(fileName, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string const extension = ".json";
+    if (fileName.size() >= extension.size()
+        && fileName.compare(fileName.size() - extension.size(), extension.size(), extension) == 0) {
+        writeJson(file);
+    }
+    else {
+        writeCsv(file);
+    }
+    return file.good();
+}
@@ -0,0 +1,17 @@
+#include "qtcpu.hpp"
+
+QtCpu::QtCpu(Cpu& cpu)
+    :_cpu(cpu)
+{
+    _cpu.setFrameObserver(this);
+}
+
+QtCpu::~QtCpu()
+{
+    _cpu.setFrameObserver(nullptr);
+}
+
+void QtCpu::frameCompleted(std::vector<std::vector<RGB>> const &)
+{
+    emit screen_refresh();
+}
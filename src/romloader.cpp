@@ -4,21 +4,35 @@
 #include <cstdio>
 
 RomLoader::RomLoader(IFileIO& fio)
-    :_fileIO(fio)
-{
-    _data.fill(0);
-}
+    :_fileIO(fio){}
 
+//mapped when the file io can, read otherwise,
+//the bytes past the largest cartridge are dropped
 bool RomLoader::load(std::string const & romName)
 {
     int fd = _fileIO.openFile(romName);
+    _data = IMemory::CartridgeData();
     if (fd > 0) {
-        _data.fill(0);
-        uint8_t buff[512];
-        int readCount = 0;
-        while (int readBit = _fileIO.readFile(buff, fd)) {
-            std::copy(std::begin(buff), std::end(buff), _data.begin() + readCount);
-            readCount += readBit;
+        std::shared_ptr<MappedFile> mappedFile = _fileIO.mapFile(fd);
+        if (mappedFile != nullptr) {
+            uint8_t const * data = mappedFile->getData();
+            size_t size = mappedFile->getSize();
+            if (size > IMemory::maxCartridgeSize) {
+                size = IMemory::maxCartridgeSize;
+            }
+            _data = IMemory::CartridgeData(std::move(mappedFile), data, size);
+        }
+        else {
+            std::vector<uint8_t> bytes;
+            uint8_t buff[512];
+            while (int readBit = _fileIO.readFile(buff, fd)) {
+                if (readBit < 0 || bytes.size() >= IMemory::maxCartridgeSize) {
+                    break;
+                }
+                size_t toCopy = std::min<size_t>(readBit, IMemory::maxCartridgeSize - bytes.size());
+                bytes.insert(bytes.end(), buff, buff + toCopy);
+            }
+            _data = IMemory::CartridgeData(std::move(bytes));
         }
         _fileIO.closeFile(fd);
     }
@@ -28,6 +42,7 @@ bool RomLoader::load(std::string const & romName)
                         );
 }
 
+//shares the bytes, no copy
 IMemory::CartridgeData RomLoader::getData()
 {
     return _data;
@@ -0,0 +1,105 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include "savefile.hpp"
+
+std::string SaveFile::getPath(std::string const & romName)
+{
+    size_t extension = romName.find_last_of('.');
+    size_t directory = romName.find_last_of('/');
+    if (extension == std::string::npos
+        || (directory != std::string::npos && extension < directory)) {
+        return romName + ".sav";
+    }
+    return romName.substr(0, extension) + ".sav";
+}
+
+SaveFile::SaveFile(std::chrono::milliseconds flushInterval)
+    :_flushInterval(flushInterval){}
+
+SaveFile::~SaveFile()
+{
+    if (_flushThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopping = true;
+        }
+        _wakeUp.notify_one();
+        _flushThread.join();
+    }
+}
+
+//the mapping stays valid once the file is closed
+bool SaveFile::open(std::string const & fileName, size_t size)
+{
+    if (_file != nullptr) {
+        return false;
+    }
+    int fd = ::open(fileName.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    std::unique_ptr<MappedFile> file(new MappedFile);
+    bool isMapped = file->mapWritable(fd, size);
+    close(fd);
+    if (!isMapped) {
+        return false;
+    }
+    _file = std::move(file);
+    _pageSize = sysconf(_SC_PAGESIZE);
+    while (_pageSize * 64 < size) {
+        _pageSize *= 2;
+    }
+    _flushThread = std::thread(&SaveFile::run, this);
+    return true;
+}
+
+uint8_t* SaveFile::getData()
+{
+    return _file != nullptr ? _file->getWritableData() : nullptr;
+}
+
+size_t SaveFile::getSize() const
+{
+    return _file != nullptr ? _file->getSize() : 0;
+}
+
+bool SaveFile::isDirty() const
+{
+    return _dirtyPages.load(std::memory_order_acquire) != 0;
+}
+
+//a page written during its sync is marked again, it goes with the next one
+void SaveFile::flush()
+{
+    uint64_t dirtyPages = _dirtyPages.exchange(0, std::memory_order_acquire);
+    for (size_t page = 0; dirtyPages != 0; page++, dirtyPages >>= 1) {
+        if ((dirtyPages & 1) == 0) {
+            continue;
+        }
+        if (_file->sync(page * _pageSize, _pageSize)) {
+            _flushedPages++;
+        }
+        else {
+            _dirtyPages.fetch_or(uint64_t(1) << page, std::memory_order_relaxed);
+        }
+    }
+}
+
+uint64_t SaveFile::getFlushedPages() const
+{
+    return _flushedPages.load();
+}
+
+//once more after the stop, the writes up to it are not lost
+void SaveFile::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    bool isStopping = false;
+    while (!isStopping) {
+        _wakeUp.wait_for(lock, _flushInterval, [this]{ return _isStopping; });
+        isStopping = _isStopping;
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include "scheduler.hpp"
+
+uint64_t const IScheduler::_never;
+
+template <class MEMORY>
+BasicScheduler<MEMORY>::BasicScheduler(Memory& memory,
+                                       BasicInterruptHandler<MEMORY>& interruptHandler,
+                                       BasicTimer<MEMORY>& timer,
+                                       BasicGraphics<MEMORY>& graphics)
+    :_interruptHandler(interruptHandler),
+     _timer(timer),
+     _graphics(graphics)
+{
+    memory.setScheduler(this);
+    _interruptHandler.setScheduler(this);
+    _timer.setScheduler(this);
+}
+
+template <class MEMORY>
+void BasicScheduler<MEMORY>::wake(EVENT event)
+{
+    if (event == EVENT::TIMER) {
+        _timer.sync(_cycles);
+    }
+    schedule(event, std::min(getDeadline(event), _cycles));
+}
+
+template <class MEMORY>
+uint64_t BasicScheduler<MEMORY>::getCycles()
+{
+    return _cycles;
+}
+
+template <class MEMORY>
+uint64_t BasicScheduler<MEMORY>::getDeadline(EVENT event) const
+{
+    return _deadlines[static_cast<int>(event)];
+}
+
+template <class MEMORY>
+int BasicScheduler<MEMORY>::getCyclesToNextEvent() const
+{
+    //the scanline always has a deadline, at most a mode away
+    return static_cast<int>(_nextDeadline - _cycles);
+}
+
+template <class MEMORY>
+void BasicScheduler<MEMORY>::reset()
+{
+    _cycles = 0;
+    _deadlines.fill(0);
+    _nextDeadline = 0;
+}
+
+template <class MEMORY>
+void BasicScheduler<MEMORY>::runEvents(int cycles)
+{
+    //each due event runs once, a component woken by one
+    //later in the order runs on the next instruction
+    if (isDue(EVENT::TIMER)) {
+        schedule(EVENT::TIMER, _timer.tickCounter(_cycles));
+    }
+    if (isDue(EVENT::SCANLINE)) {
+        schedule(EVENT::SCANLINE, _graphics.tickScanline(_cycles, cycles));
+    }
+    if (isDue(EVENT::INTERRUPT)) {
+        //nothing changes until a request, a mask or the master switch does
+        _interruptHandler.doInterrupt();
+        schedule(EVENT::INTERRUPT, _never);
+    }
+}
+
+template <class MEMORY>
+bool BasicScheduler<MEMORY>::isDue(EVENT event) const
+{
+    return getDeadline(event) <= _cycles;
+}
+
+template <class MEMORY>
+void BasicScheduler<MEMORY>::schedule(EVENT event, uint64_t deadline)
+{
+    _deadlines[static_cast<int>(event)] = deadline;
+    _nextDeadline = *std::min_element(_deadlines.begin(), _deadlines.end());
+}
+
+template class BasicScheduler<IMemory>;
+template class BasicScheduler<Memory>;
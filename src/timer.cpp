@@ -2,62 +2,147 @@
 #include <iostream>
 
 #include "timer.hpp"
+#include "memory.hpp"
 
 
-Timer::Timer(IMemory& memory, IInterruptHandler& interruptHandler)
+template <class MEMORY>
+BasicTimer<MEMORY>::BasicTimer(MEMORY& memory, IInterruptHandler& interruptHandler)
     :_memory(memory),
-     _interruptHandler(interruptHandler){};
+     _interruptHandler(interruptHandler)
+{
+    _memory.setIoHandler(_DIV, this);
+    _memory.setIoHandler(_TMC, this);
+}
 
+template <class MEMORY>
+BasicTimer<MEMORY>::~BasicTimer()
+{
+    _memory.setIoHandler(_DIV, nullptr);
+    _memory.setIoHandler(_TMC, nullptr);
+}
 
-bool Timer::isOn()
+template <class MEMORY>
+void BasicTimer<MEMORY>::setScheduler(IScheduler* scheduler)
+{
+    _scheduler = scheduler;
+}
+
+template <class MEMORY>
+uint64_t BasicTimer<MEMORY>::getClock() const
+{
+    return _scheduler != nullptr ? _scheduler->getCycles() : _clock;
+}
+
+template <class MEMORY>
+uint8_t BasicTimer<MEMORY>::readIo(uint16_t adress, uint8_t value)
+{
+    if (adress == _DIV) {
+        return static_cast<uint8_t>((getClock() - _dividerResetCycles) >> 8);
+    }
+    return value;
+}
+
+template <class MEMORY>
+uint8_t BasicTimer<MEMORY>::writeIo(uint16_t adress, uint8_t data, uint8_t value)
+{
+    if (adress == _DIV) {
+        _dividerResetCycles = getClock();
+        return 0;
+    }
+    if ((data & 0x03) != (value & 0x03)) {
+        _cycleCounter = _clockSpeed / _speed.at(data & 0x03);
+    }
+    return data;
+}
+
+
+template <class MEMORY>
+void BasicTimer<MEMORY>::reset()
+{
+    _cycleCounter = 1024;
+    _clock = 0;
+    _dividerResetCycles = 0;
+    _syncCycles = 0;
+    _isCounting = false;
+}
+
+template <class MEMORY>
+bool BasicTimer<MEMORY>::isOn()
 {
     uint8_t timerControler = _memory.readInMemory(_TMC);
     std::bitset<8> timerControlerBitset (timerControler);
     return timerControlerBitset.test(2);
 }
 
-void Timer::update(int cycles)
+template <class MEMORY>
+void BasicTimer<MEMORY>::update(int cycles)
 {
-    doDividerRegister(cycles);
+    _clock += cycles;
 
     if(isOn()) {
         _cycleCounter -= cycles;
 
         if (_cycleCounter <= 0) {
             setClockFrequency();
-
-            uint8_t timerCounter = _memory.readInMemory(_TIMA);
-            if (timerCounter == 0xff) {
-                uint8_t timerModulo = _memory.readInMemory(_TMA);
-                _memory.writeInMemory(timerModulo, _TIMA);
-                _interruptHandler.requestInterrupt(IInterruptHandler::INTERRUPT::TIMER);
-            }
-            else {
-                _memory.writeInMemory(timerCounter + 1, _TIMA);
-            }
+            incrementCounter();
         }
     }
 }
 
-uint32_t Timer::getClockFrequency()
+template <class MEMORY>
+uint64_t BasicTimer<MEMORY>::tickCounter(uint64_t cycles)
+{
+    sync(cycles);
+    if (!_isCounting) {
+        return IScheduler::_never;
+    }
+    if (_cycleCounter <= 0) {
+        setClockFrequency();
+        incrementCounter();
+    }
+    return cycles + _cycleCounter;
+}
+
+template <class MEMORY>
+void BasicTimer<MEMORY>::sync(uint64_t cycles)
+{
+    //the controler has not changed since the latest sync
+    _isCounting = isOn();
+    if (_isCounting) {
+        _cycleCounter -= static_cast<int>(cycles - _syncCycles);
+    }
+    _syncCycles = cycles;
+}
+
+template <class MEMORY>
+void BasicTimer<MEMORY>::incrementCounter()
+{
+    uint8_t timerCounter = _memory.readInMemory(_TIMA);
+    if (timerCounter == 0xff) {
+        uint8_t timerModulo = _memory.readInMemory(_TMA);
+        _memory.writeInMemory(timerModulo, _TIMA);
+        _interruptHandler.requestInterrupt(IInterruptHandler::INTERRUPT::TIMER);
+    }
+    else {
+        _memory.writeInMemory(timerCounter + 1, _TIMA);
+    }
+}
+
+template <class MEMORY>
+uint32_t BasicTimer<MEMORY>::getClockFrequency()
 {
     uint8_t tmc = _memory.readInMemory(_TMC) & 0x03;
     auto const & frequency = _speed.find(tmc);
     return frequency->second;
 }
 
-int Timer::setClockFrequency()
+template <class MEMORY>
+int BasicTimer<MEMORY>::setClockFrequency()
 {
     uint32_t frequency = getClockFrequency();
     _cycleCounter = _clockSpeed/frequency;
     return _cycleCounter;
 }
 
-void Timer::doDividerRegister(int cycles)
-{
-    _dividerRegister += cycles;
-    if(_dividerRegister >= 0xff) {
-        _dividerRegister = 0;
-        _memory.incrementDividerRegister();
-    }
-}
+template class BasicTimer<IMemory>;
+template class BasicTimer<Memory>;
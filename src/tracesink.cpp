@@ -0,0 +1,31 @@
+#include "tracesink.hpp"
+
+TraceSink::TraceSink(std::string const & fileName)
+    :_file(fileName, std::ios::binary | std::ios::trunc),
+     _buffer(_bufferSize){};
+
+TraceSink::~TraceSink()
+{
+    flush();
+}
+
+bool TraceSink::isOpen() const
+{
+    return _file.is_open();
+}
+
+void TraceSink::flush()
+{
+    if (_used == 0) {
+        return;
+    }
+    _file.write(reinterpret_cast<char const *>(_buffer.data()), _used * sizeof(Record));
+    _file.flush();
+    _recordCount += _used;
+    _used = 0;
+}
+
+uint64_t TraceSink::getRecordCount() const
+{
+    return _recordCount + _used;
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "memory.hpp"
+#include "interupthandler.hpp"
+#include "timer.hpp"
+#include "graphics.hpp"
+#include "scheduler.hpp"
+#include "blockcache.hpp"
+#include "lockstep.hpp"
+
+class BlockCacheTest : public ::testing::Test
+{
+public:
+
+    BlockCacheTest()
+        :_interruptHandler(_memory),
+         _timer(_memory, _interruptHandler),
+         _graphics(_memory, _interruptHandler),
+         _scheduler(_memory, _interruptHandler, _timer, _graphics),
+         _blockCache(_memory, _interruptHandler)
+    {
+        _blockCache.setScheduler(&_scheduler);
+        //INC A, INC B, JR back to INC A
+        std::vector<uint8_t> loop = {0x3C, 0x04, 0x18, 0xFC};
+        for (size_t index = 0; index < loop.size(); index++) {
+            _memory.writeInMemory(loop[index], 0xc000 + index);
+        }
+        _memory.set16BitRegister(IMemory::REG16BIT::PC, 0xc000);
+    }
+
+    //one block a run
+    void run(int runs)
+    {
+        for (int index = 0; index < runs; index++) {
+            _blockCache.run();
+        }
+    }
+
+    Memory _memory;
+    BasicInterruptHandler<Memory> _interruptHandler;
+    BasicTimer<Memory> _timer;
+    BasicGraphics<Memory> _graphics;
+    BasicScheduler<Memory> _scheduler;
+    BlockCache _blockCache;
+};
+
+TEST_F(BlockCacheTest, replaysDecodedBlock)
+{
+    run(10);
+    EXPECT_EQ(10, _memory.get8BitRegister(IMemory::REG8BIT::A));
+    EXPECT_EQ(10, _memory.get8BitRegister(IMemory::REG8BIT::B));
+    BlockCache::Stats const & stats = _blockCache.getStats();
+    EXPECT_EQ(1, stats.blocks);
+    EXPECT_EQ(10, stats.lookups);
+    EXPECT_EQ(9, stats.hits);
+    EXPECT_DOUBLE_EQ(0.9, stats.getHitRate());
+    EXPECT_EQ(30u, stats.instructions);
+}
+
+TEST_F(BlockCacheTest, writeInBlockInvalidatesIt)
+{
+    run(1);
+    //INC B becomes DEC B
+    _memory.writeInMemory(0x05, 0xc001);
+    EXPECT_EQ(0, _blockCache.getStats().blocks);
+    EXPECT_EQ(1, _blockCache.getStats().invalidations);
+    run(1);
+    EXPECT_EQ(2, _memory.get8BitRegister(IMemory::REG8BIT::A));
+    EXPECT_EQ(0, _memory.get8BitRegister(IMemory::REG8BIT::B));
+    EXPECT_EQ(1, _blockCache.getStats().blocks);
+}
+
+TEST_F(BlockCacheTest, writeInEchoRamInvalidatesMirroredBlock)
+{
+    run(1);
+    _memory.writeInMemory(0x05, 0xe001);
+    EXPECT_EQ(0, _blockCache.getStats().blocks);
+    run(1);
+    EXPECT_EQ(0, _memory.get8BitRegister(IMemory::REG8BIT::B));
+}
+
+TEST_F(BlockCacheTest, writeOutsideBlockKeepsIt)
+{
+    run(1);
+    _memory.writeInMemory(0x05, 0xc004);
+    EXPECT_EQ(1, _blockCache.getStats().blocks);
+    EXPECT_EQ(0, _blockCache.getStats().invalidations);
+}
+
+TEST_F(BlockCacheTest, newCartridgeClearsBlocks)
+{
+    run(1);
+    //INC A / HALT, the block ends on HALT
+    std::vector<uint8_t> cartridge(0x8000);
+    cartridge[0x100] = 0x3C;
+    cartridge[0x101] = 0x76;
+    ASSERT_TRUE(_memory.setCartridge(IMemory::CartridgeData(std::move(cartridge))));
+    EXPECT_EQ(0, _blockCache.getStats().blocks);
+    run(1);
+    EXPECT_EQ(0x0102, _memory.get16BitRegister(IMemory::REG16BIT::PC));
+    //the three of the loop and these two
+    EXPECT_EQ(5u, _blockCache.getStats().instructions);
+}
+
+TEST_F(BlockCacheTest, romBankSwitchDropsBlocksOfTheBank)
+{
+    //mbc1, 4 banks each starting with ld a,bank / inc b
+    std::vector<uint8_t> cartridge(0x10000);
+    cartridge[0x147] = 0x01;
+    cartridge[0x148] = 0x01;
+    for (int bank = 1; bank < 4; bank++) {
+        cartridge[bank * 0x4000] = 0x3E;
+        cartridge[bank * 0x4000 + 1] = bank;
+        cartridge[bank * 0x4000 + 2] = 0x04;
+    }
+    ASSERT_TRUE(_memory.setCartridge(IMemory::CartridgeData(std::move(cartridge))));
+    _memory.set16BitRegister(IMemory::REG16BIT::PC, 0x4000);
+    run(1);
+    EXPECT_EQ(1, _memory.get8BitRegister(IMemory::REG8BIT::A));
+    EXPECT_EQ(1, _blockCache.getStats().blocks);
+
+    _memory.writeInMemory(0x02, 0x2000);
+    EXPECT_EQ(0, _blockCache.getStats().blocks);
+    _memory.set16BitRegister(IMemory::REG16BIT::PC, 0x4000);
+    run(1);
+    EXPECT_EQ(2, _memory.get8BitRegister(IMemory::REG8BIT::A));
+
+    //the same bank again, nothing to drop
+    _memory.writeInMemory(0x02, 0x2000);
+    EXPECT_EQ(1, _blockCache.getStats().blocks);
+}
+
+//the stepped Interpreter catches up with each superinstruction
+class FusionTest : public LockstepTest
+{
+public:
+
+    FusionTest()
+        :LockstepTest(Cpu::CORE::INTERPRETER, Cpu::CORE::BLOCK_CACHE){}
+};
+
+TEST_P(FusionTest, sameStateAsStepping)
+{
+    runInLockstep(GetParam(), 100000);
+    EXPECT_LT(0u, _machine.getCore<BlockCache>().getStats().fusedRuns);
+}
+
+INSTANTIATE_TEST_CASE_P(CpuInstrs, FusionTest, ::testing::ValuesIn(cpuInstrsRoms), getRomTestName);
+
+TEST_F(FusionTest, runsEachIdiomAsOneStep)
+{
+    //ld b,03 / dec b / jr nz,-3 / ld hl,c100 / ld de,c200 / ld a,(hl+) / ld (de),a
+    //ldh a,(44) / cp 00 / jr nz,00 / ldh a,(44) / cp 00 / jr 00
+    std::vector<uint8_t> const program = {
+        0x06, 0x03, 0x05, 0x20, 0xFD, 0x21, 0x00, 0xc1, 0x11, 0x00, 0xc2, 0x2A, 0x12,
+        0xF0, 0x44, 0xFE, 0x00, 0x20, 0x00, 0xF0, 0x44, 0xFE, 0x00, 0x18, 0x00};
+    for (auto* memory : {&_reference.memory, &_machine.memory}) {
+        for (size_t index = 0; index < program.size(); index++) {
+            memory->writeInMemory(program[index], 0xc000 + index);
+        }
+        memory->writeInMemory(0x5A, 0xc100);
+        memory->set16BitRegister(IMemory::REG16BIT::PC, 0xc000);
+    }
+    //a step runs a whole block, the superinstructions in it
+    //only run with no event due before their end
+    int blockSteps = 0;
+    while (_machine.memory.get16BitRegister(IMemory::REG16BIT::PC) != 0xc019) {
+        ASSERT_TRUE(_machine.step());
+        blockSteps++;
+    }
+    int steps = 0;
+    while (_reference.memory.get16BitRegister(IMemory::REG16BIT::PC) != 0xc019) {
+        ASSERT_TRUE(_reference.step());
+        steps++;
+    }
+    EXPECT_EQ(5, blockSteps);
+    EXPECT_EQ(17, steps);
+    EXPECT_EQ(0xc019, _machine.memory.get16BitRegister(IMemory::REG16BIT::PC));
+    EXPECT_EQ(_reference.cycles, _machine.cycles);
+    EXPECT_EQ(_reference.memory.get16BitRegister(IMemory::REG16BIT::AF),
+              _machine.memory.get16BitRegister(IMemory::REG16BIT::AF));
+    EXPECT_EQ(0x5A, _machine.memory.readInMemory(0xc200));
+    EXPECT_LT(0u, _machine.getCore<BlockCache>().getStats().fusedRuns);
+}
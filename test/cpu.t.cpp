@@ -40,10 +40,8 @@ class MockMemory : public IMemory
 {
 public:
 
-    MOCK_METHOD0(incrementDividerRegister, void());
     MOCK_METHOD0(incrementScanline, void());
-    MOCK_METHOD0(getCartridge, CartridgeData const());
-    MOCK_METHOD0(getReadOnlyMemory, RomData const());
+    MOCK_METHOD0(getCartridge, CartridgeData const &());
     MOCK_METHOD1(setCartridge, bool(CartridgeData const &));
     MOCK_METHOD0(getState, IMemory::State());
     MOCK_METHOD0(initializeMemory, void());
@@ -69,10 +67,10 @@ public:
     CpuTest()
         :_instructions(0)
   {
+        std::vector<uint8_t> cartridge(0x8000);
         uint8_t hex = 0;
-        _emptyCartridge.fill(0x00);
-        for (size_t index = 0x0; index < IMemory::cartridgeSize; index++) {
-            _cartridge[index] = hex;
+        for (size_t index = 0x0; index < cartridge.size(); index++) {
+            cartridge[index] = hex;
             if (hex == 255) {
                 hex = 0;
             }
@@ -80,6 +78,8 @@ public:
                 hex++;
             }
         }
+        _cartridge = IMemory::CartridgeData(std::move(cartridge));
+        _emptyCartridge = IMemory::CartridgeData(std::vector<uint8_t>(0x8000, 0x00));
     }
 
     MockRomLoader _RL;
@@ -130,3 +130,143 @@ public:
 //     cpu.launchGame(_fileName);
 // }
 
+
+//stops the game after a few frames, update would run forever
+class FrameCounter : public IFrameObserver
+{
+public:
+
+    FrameCounter(Cpu& cpu, int framesToRun)
+        :_cpu(cpu),
+         _framesToRun(framesToRun){}
+
+    void frameCompleted(std::vector<std::vector<RGB>> const & screen) override
+    {
+        EXPECT_EQ(144u, screen.size());
+        if (++_frames == _framesToRun) {
+            _cpu.stopGame();
+        }
+    }
+
+    Cpu& _cpu;
+    int _framesToRun;
+    int _frames = 0;
+};
+
+class CpuRunTest : public CpuTest
+{
+public:
+
+    CpuRunTest()
+    {
+        //nop / nop / jp 0102
+        _rom[0x0102] = 0xC3;
+        _rom[0x0103] = 0x02;
+        _rom[0x0104] = 0x01;
+        EXPECT_CALL(_RL, load(_fileName))
+            .WillRepeatedly(Return(true));
+        _cpu.reset(new Cpu(_RL, Cpu::CORE::INTERPRETER));
+    }
+
+    void load()
+    {
+        EXPECT_CALL(_RL, getData())
+            .WillOnce(Return(IMemory::CartridgeData(_rom)));
+        ASSERT_TRUE(_cpu->loadGame(_fileName));
+    }
+
+    std::vector<uint8_t> _rom = std::vector<uint8_t>(0x8000, 0x00);
+    std::unique_ptr<Cpu> _cpu;
+};
+
+TEST_F (CpuRunTest, runWithoutGame)
+{
+    EXPECT_EQ(Cpu::RUN_STATUS::NO_GAME, _cpu->runCycles(100));
+    EXPECT_EQ(Cpu::RUN_STATUS::NO_GAME, _cpu->runFrame());
+}
+
+TEST_F (CpuRunTest, runCyclesAndFrames)
+{
+    load();
+    EXPECT_EQ(Cpu::RUN_STATUS::CYCLES_DONE, _cpu->runCycles(8));
+    EXPECT_EQ(8, _cpu->getCurrentCycles());
+    EXPECT_EQ(0x0102, _cpu->getState().pcValue);
+
+    //the instruction ending the frame may run past it
+    EXPECT_EQ(Cpu::RUN_STATUS::FRAME_COMPLETE, _cpu->runFrame());
+    EXPECT_GT(16, _cpu->getCurrentCycles());
+    EXPECT_EQ(Cpu::RUN_STATUS::FRAME_COMPLETE, _cpu->runCycles(70224));
+}
+
+TEST_F (CpuRunTest, stopOnBreakpoint)
+{
+    load();
+    _cpu->addBreakpoint(0x0101);
+    EXPECT_EQ(Cpu::RUN_STATUS::BREAKPOINT, _cpu->runCycles(1000));
+    EXPECT_EQ(0x0101, _cpu->getState().pcValue);
+    EXPECT_EQ(4, _cpu->getCurrentCycles());
+
+    //the instruction at the breakpoint runs on the next call
+    EXPECT_EQ(Cpu::RUN_STATUS::CYCLES_DONE, _cpu->runCycles(1000));
+    _cpu->removeBreakpoint(0x0101);
+}
+
+TEST_F (CpuRunTest, stopOnFault)
+{
+    _rom[0x0101] = 0xD3;
+    load();
+    EXPECT_EQ(Cpu::RUN_STATUS::FAULT, _cpu->runFrame());
+    EXPECT_TRUE(_cpu->isLocked());
+    EXPECT_EQ(0x0101, _cpu->getFault().pc);
+    //the events still run once the CPU is hung
+    EXPECT_EQ(Cpu::RUN_STATUS::FRAME_COMPLETE, _cpu->runFrame());
+}
+
+TEST_F (CpuRunTest, nextGameStartsUnlocked)
+{
+    _rom[0x0101] = 0xD3;
+    load();
+    EXPECT_EQ(Cpu::RUN_STATUS::FAULT, _cpu->runFrame());
+
+    _rom[0x0101] = 0x00;
+    load();
+    EXPECT_FALSE(_cpu->isLocked());
+    EXPECT_EQ(0x0000, _cpu->getFault().pc);
+    EXPECT_EQ(Cpu::RUN_STATUS::CYCLES_DONE, _cpu->runCycles(8));
+    EXPECT_EQ(0x0102, _cpu->getState().pcValue);
+
+    //and its own fault is reported
+    _rom[0x0101] = 0xD3;
+    load();
+    EXPECT_EQ(Cpu::RUN_STATUS::FAULT, _cpu->runFrame());
+    EXPECT_EQ(0x0101, _cpu->getFault().pc);
+}
+
+TEST_F (CpuRunTest, nextGameStartsFromTheFirstCycle)
+{
+    load();
+    EXPECT_EQ(Cpu::RUN_STATUS::CYCLES_DONE, _cpu->runCycles(12345));
+
+    Cpu fresh(_RL, Cpu::CORE::INTERPRETER);
+    for (Cpu* cpu : {_cpu.get(), &fresh}) {
+        EXPECT_CALL(_RL, getData())
+            .WillOnce(Return(IMemory::CartridgeData(_rom)));
+        ASSERT_TRUE(cpu->loadGame(_fileName));
+        EXPECT_EQ(0, cpu->getCurrentCycles());
+        EXPECT_EQ(Cpu::RUN_STATUS::CYCLES_DONE, cpu->runCycles(1000));
+    }
+    //the scanline and the frame count from the new game
+    EXPECT_EQ(fresh.getCurrentCycles(), _cpu->getCurrentCycles());
+    EXPECT_EQ(fresh.getState().pcValue, _cpu->getState().pcValue);
+    EXPECT_EQ(fresh.getState().readOnlyMemory, _cpu->getState().readOnlyMemory);
+}
+
+TEST_F (CpuRunTest, frameObserverIsToldEachFrame)
+{
+    FrameCounter counter(*_cpu, 3);
+    _cpu->setFrameObserver(&counter);
+    EXPECT_CALL(_RL, getData())
+        .WillOnce(Return(IMemory::CartridgeData(_rom)));
+    EXPECT_TRUE(_cpu->launchGame(_fileName));
+    EXPECT_EQ(3, counter._frames);
+}
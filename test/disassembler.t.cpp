@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include "memory.hpp"
+#include "disassembler.hpp"
+
+TEST(DisassemblerTest, formatsRegistersAndImmediates)
+{
+    EXPECT_EQ("nop", Disassembler::disassemble({0x00, 0x00, 0x00}, 0x00));
+    EXPECT_EQ("ld B,12", Disassembler::disassemble({0x06, 0x12, 0x00}, 0x00));
+    EXPECT_EQ("ld SP,fffe", Disassembler::disassemble({0x31, 0xfe, 0xff}, 0x00));
+    EXPECT_EQ("ld (HL+),A", Disassembler::disassemble({0x22, 0x00, 0x00}, 0x00));
+    EXPECT_EQ("ld A, B", Disassembler::disassemble({0x78, 0x00, 0x00}, 0x00));
+    EXPECT_EQ("ldh (44),A", Disassembler::disassemble({0xE0, 0x44, 0x00}, 0x00));
+    EXPECT_EQ("jr fffffffe", Disassembler::disassemble({0x18, 0xfe, 0x00}, 0x00));
+    EXPECT_EQ("rst38h", Disassembler::disassemble({0xFF, 0x00, 0x00}, 0x00));
+    EXPECT_EQ("daa", Disassembler::disassemble({0x27, 0x00, 0x00}, 0x00));
+    EXPECT_EQ("cb", Disassembler::disassemble({0xCB, 0x7c, 0x00}, 0x00));
+}
+
+TEST(DisassemblerTest, conditionalJumpsDependOnFlags)
+{
+    uint8_t const zeroFlag = 0x80;
+    EXPECT_EQ("jr nZ,$5", Disassembler::disassemble({0x20, 0x05, 0x00}, 0x00));
+    EXPECT_EQ("jr nZ,$[condition not met]", Disassembler::disassemble({0x20, 0x05, 0x00}, zeroFlag));
+    EXPECT_EQ("call Z,$1234", Disassembler::disassemble({0xCC, 0x34, 0x12}, zeroFlag));
+    EXPECT_EQ("jp C,$[condition not met]", Disassembler::disassemble({0xDA, 0x34, 0x12}, zeroFlag));
+    EXPECT_EQ("ret Z", Disassembler::disassemble({0xC0, 0x00, 0x00}, zeroFlag));
+}
+
+TEST(DisassemblerTest, readsFromMemory)
+{
+    Memory memory;
+    memory.writeInMemory(0x3E, 0xc000);
+    memory.writeInMemory(0x42, 0xc001);
+    EXPECT_EQ("ld A,42", Disassembler::disassemble(memory, 0xc000));
+    EXPECT_EQ("[3e] ld A,42", Disassembler::getHistoryLine({0x3E, 0x42, 0x00}, 0x00));
+    EXPECT_EQ("", Disassembler::disassemble({0xD3, 0x00, 0x00}, 0x00));
+}
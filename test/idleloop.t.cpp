@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "memory.hpp"
+#include "interupthandler.hpp"
+#include "timer.hpp"
+#include "graphics.hpp"
+#include "interpreter.hpp"
+#include "scheduler.hpp"
+#include "idleloop.hpp"
+
+struct IdleMachine
+{
+    IdleMachine()
+        :interruptHandler(memory),
+         timer(memory, interruptHandler),
+         graphics(memory, interruptHandler),
+         interpreter(memory, interruptHandler),
+         scheduler(memory, interruptHandler, timer, graphics),
+         idleLoop(memory, scheduler)
+    {}
+
+    void load(std::vector<uint8_t> const & program)
+    {
+        for (size_t index = 0; index < program.size(); index++) {
+            memory.writeInMemory(program[index], 0xc000 + index);
+        }
+        memory.set16BitRegister(IMemory::REG16BIT::PC, 0xc000);
+    }
+
+    //runs until PC reaches endPc, skipping the polling loops or not
+    void run(uint16_t endPc, bool isSkipping)
+    {
+        for (int step = 0; step < 100000; step++) {
+            uint16_t pcValue = memory.get16BitRegister(IMemory::REG16BIT::PC);
+            if (pcValue == endPc) {
+                return;
+            }
+            scheduler.update(interpreter.doInstruction(memory.readInMemory(pcValue)));
+            if (isSkipping && memory.get16BitRegister(IMemory::REG16BIT::PC) <= pcValue) {
+                idleLoop.skip(pcValue, 70224);
+            }
+        }
+    }
+
+    Memory memory;
+    BasicInterruptHandler<Memory> interruptHandler;
+    BasicTimer<Memory> timer;
+    BasicGraphics<Memory> graphics;
+    Interpreter interpreter;
+    BasicScheduler<Memory> scheduler;
+    IdleLoopDetector idleLoop;
+};
+
+class IdleLoopTest : public ::testing::Test
+{
+public:
+
+    void expectSameState()
+    {
+        EXPECT_EQ(_stepped.scheduler.getCycles(), _skipped.scheduler.getCycles());
+        EXPECT_EQ(_stepped.memory.get16BitRegister(IMemory::REG16BIT::PC),
+                  _skipped.memory.get16BitRegister(IMemory::REG16BIT::PC));
+        EXPECT_EQ(_stepped.memory.get16BitRegister(IMemory::REG16BIT::AF),
+                  _skipped.memory.get16BitRegister(IMemory::REG16BIT::AF));
+        for (int adress = 0xff00; adress <= 0xffff; adress++) {
+            ASSERT_EQ(_stepped.memory.readInMemory(adress), _skipped.memory.readInMemory(adress))
+                << std::hex << adress;
+        }
+    }
+
+    IdleMachine _stepped;
+    IdleMachine _skipped;
+};
+
+TEST_F(IdleLoopTest, skipsLYPollingToTheSameState)
+{
+    //ldh a,(44) / cp 90 / jr nz,-6 / halt
+    std::vector<uint8_t> const program = {0xF0, 0x44, 0xFE, 0x90, 0x20, 0xFA, 0x76};
+    _stepped.load(program);
+    _skipped.load(program);
+    _stepped.run(0xc006, false);
+    _skipped.run(0xc006, true);
+
+    expectSameState();
+    EXPECT_EQ(0x90, _skipped.memory.readInMemory(0xff44));
+    EXPECT_LT(0u, _skipped.idleLoop.getStats().skippedCycles);
+    EXPECT_EQ(0u, _stepped.idleLoop.getStats().skips);
+}
+
+TEST_F(IdleLoopTest, leavesOtherLoopsAlone)
+{
+    //ldh a,(44) / inc a / jr nz,-5, A changes every iteration
+    _skipped.load({0xF0, 0x44, 0x3C, 0x20, 0xFB});
+    _skipped.run(0xc005, true);
+    EXPECT_EQ(0u, _skipped.idleLoop.getStats().skips);
+
+    //entered on the branch with A not yet loaded
+    _skipped.load({0xF0, 0x44, 0xFE, 0x90, 0x20, 0xFA, 0x76});
+    _skipped.memory.set8BitRegister(IMemory::REG8BIT::A, ~_skipped.memory.readInMemory(0xff44));
+    _skipped.memory.set16BitRegister(IMemory::REG16BIT::PC, 0xc004);
+    EXPECT_EQ(0, _skipped.idleLoop.skip(0xc004, 70224));
+    EXPECT_EQ(0u, _skipped.idleLoop.getStats().skips);
+}
@@ -27,10 +27,8 @@ class MockMemory : public IMemory
 {
 public:
 
-    MOCK_METHOD0(incrementDividerRegister, void());
     MOCK_METHOD0(incrementScanline, void());
-    MOCK_METHOD0(getCartridge, CartridgeData const());
-    MOCK_METHOD0(getReadOnlyMemory, RomData const());
+    MOCK_METHOD0(getCartridge, CartridgeData const &());
     MOCK_METHOD1(setCartridge, bool(CartridgeData const &));
     MOCK_METHOD0(getState, IMemory::State());
     MOCK_METHOD0(initializeMemory, void());
@@ -52,9 +50,7 @@ class InstructionHandlerTest : public ::testing::Test
 {
 public:
 
-    InstructionHandlerTest() {
-        _cartridge.fill(0);
-    }
+    InstructionHandlerTest() {}
 
     int load16NextBitToRegister(IMemory::RomData rom, IMemory::REG16BIT reg);
     int load8NextBitToRegister(IMemory::RomData rom, IMemory::REG8BIT reg);
@@ -87,7 +83,6 @@ public:
 
     MockMemory _memory;
     MockInterruptHandler _interruptHandler;
-    IMemory::CartridgeData _cartridge;
 
 };
 
@@ -521,12 +516,13 @@ TEST_F (InstructionHandlerTest, load8NextBitAndSPToHL)
             .WillOnce(Return(0xFFF8));
         EXPECT_CALL(_memory, readInMemory(0x0001))
             .WillOnce(Return(0xfe));
+        //0xF8 + 0xFE carries out of the low nibble and the low byte
         EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::HL, 0xFFF6));
         EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::PC, 0x0002));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, setFlag(IMemory::FLAG::H));
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::C));
+        EXPECT_CALL(_memory, setFlag(IMemory::FLAG::C));
 
         EXPECT_EQ(12, instructionHandler.doInstruction(0xF8));
     }
@@ -564,19 +560,9 @@ int InstructionHandlerTest::addValueTo16BitRegister(uint16_t opCode, IMemory::RE
 
     EXPECT_CALL(_memory, get16BitRegister(reg))
         .WillOnce(Return(0x0000));
-    if ((0x0000 + value) == 0) {
-        EXPECT_CALL(_memory, setFlag(IMemory::FLAG::Z));
-    }
-    else {
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
-    }
-    if (value < 0) {
-        EXPECT_CALL(_memory, setFlag(IMemory::FLAG::N));
-    }
-    else {
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
-    }
-    EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
+    //the flags are kept
+    EXPECT_CALL(_memory, setFlag(_)).Times(0);
+    EXPECT_CALL(_memory, unsetFlag(_)).Times(0);
     EXPECT_CALL(_memory, set16BitRegister(reg, 0x0000 + value));
     EXPECT_CALL(_memory, get16BitRegister(IMemory::REG16BIT::PC))
         .WillOnce(Return(0x0000));
@@ -951,7 +937,9 @@ int InstructionHandlerTest::popIn16BitReg(uint8_t opCode, IMemory::REG16BIT reg1
         .WillOnce(Return(0x3C));
     EXPECT_CALL(_memory, readInMemory(0xFFFC))
         .WillOnce(Return(0x5F));
-    EXPECT_CALL(_memory, set16BitRegister(reg16Bit, 0x3C5F));
+    //the low nibble of F always reads 0
+    uint16_t popped = reg16Bit == IMemory::REG16BIT::AF ? 0x3C50 : 0x3C5F;
+    EXPECT_CALL(_memory, set16BitRegister(reg16Bit, popped));
     EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::SP, 0xFFFE));
     EXPECT_CALL(_memory, get16BitRegister(IMemory::REG16BIT::PC))
         .WillOnce(Return(0x0001));
@@ -1699,7 +1687,7 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheLeftAndStore7thBitTo0thBit
         EXPECT_CALL(_memory, get8BitRegister(IMemory::REG8BIT::A))
             .WillOnce(Return(0x85));
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x0B));
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z)).Times(2);
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, setFlag(IMemory::FLAG::C));
@@ -1715,7 +1703,9 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheLeftAndStore7thBitTo0thBit
         EXPECT_CALL(_memory, get8BitRegister(IMemory::REG8BIT::A))
             .WillOnce(Return(0x00));
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x00));
+        //the result is 0 but Z is cleared anyway
         EXPECT_CALL(_memory, setFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::C));
@@ -1737,7 +1727,7 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheLeftAndStoreCarryIn0thBit)
         EXPECT_CALL(_memory, isSetFlag(IMemory::FLAG::C))
             .WillOnce(Return(true));
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x2B));
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z)).Times(2);
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, setFlag(IMemory::FLAG::C));
@@ -1755,7 +1745,9 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheLeftAndStoreCarryIn0thBit)
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x00));
         EXPECT_CALL(_memory, isSetFlag(IMemory::FLAG::C))
             .WillOnce(Return(false));
+        //the result is 0 but Z is cleared anyway
         EXPECT_CALL(_memory, setFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::C));
@@ -1775,7 +1767,7 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheRightAndStore7thBitTo0thBi
         EXPECT_CALL(_memory, get8BitRegister(IMemory::REG8BIT::A))
             .WillOnce(Return(0x3B));
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x9D));
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z)).Times(2);
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, setFlag(IMemory::FLAG::C));
@@ -1791,7 +1783,7 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheRightAndStore7thBitTo0thBi
         EXPECT_CALL(_memory, get8BitRegister(IMemory::REG8BIT::A))
             .WillOnce(Return(0xFE));
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x7F));
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z)).Times(2);
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::C));
@@ -1813,7 +1805,7 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheRightAndStoreCarryIn0thBit
         EXPECT_CALL(_memory, isSetFlag(IMemory::FLAG::C))
             .WillOnce(Return(false));
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x40));
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z)).Times(2);
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, setFlag(IMemory::FLAG::C));
@@ -1831,7 +1823,7 @@ TEST_F (InstructionHandlerTest, rotateRegAContentToTheRightAndStoreCarryIn0thBit
         EXPECT_CALL(_memory, isSetFlag(IMemory::FLAG::C))
             .WillOnce(Return(true));
         EXPECT_CALL(_memory, set8BitRegister(IMemory::REG8BIT::A, 0x80));
-        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z));
+        EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::Z)).Times(2);
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::N));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::H));
         EXPECT_CALL(_memory, unsetFlag(IMemory::FLAG::C));
@@ -1944,7 +1936,8 @@ TEST_F (InstructionHandlerTest, jumpToAdressAndNext8Bit)
             .WillOnce(Return(0x8000));
         EXPECT_CALL(_memory, readInMemory(0x8001))
             .WillOnce(Return(0x10));
-        EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::PC, 0x8011));
+        //relative to the next instruction
+        EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::PC, 0x8012));
 
         EXPECT_EQ(12, instructionHandler.doInstruction(0x18));
     }
@@ -1955,7 +1948,7 @@ TEST_F (InstructionHandlerTest, jumpToAdressAndNext8Bit)
             .WillOnce(Return(0x8000));
         EXPECT_CALL(_memory, readInMemory(0x8001))
             .WillOnce(Return(0xFE));
-        EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::PC, 0x7FFF));
+        EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::PC, 0x8000));
 
         EXPECT_EQ(12, instructionHandler.doInstruction(0x18));
     }
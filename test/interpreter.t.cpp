@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "lockstep.hpp"
+
+//the reference runs with lazy flags, as in Cpu
+class InterpreterTest : public LockstepTest
+{
+public:
+
+    InterpreterTest()
+        :LockstepTest(Cpu::CORE::REFERENCE, Cpu::CORE::INTERPRETER){}
+};
+
+TEST_P(InterpreterTest, sameStateAsReference)
+{
+    runInLockstep(GetParam(), 100000);
+}
+
+INSTANTIATE_TEST_CASE_P(CpuInstrs, InterpreterTest, ::testing::ValuesIn(cpuInstrsRoms), getRomTestName);
+
+//both cores run each rom to its end on their own
+class CpuInstrsTest : public ::testing::TestWithParam<std::string>
+{
+public:
+
+    std::string runToResult(Cpu::CORE coreType)
+    {
+        LockstepMachine machine(coreType);
+        SerialOutput serialOutput(machine.memory);
+        FileIO fileIO;
+        RomLoader romLoader(fileIO);
+        EXPECT_TRUE(romLoader.load(GB_TEST_ROM_DIR + GetParam()));
+        EXPECT_TRUE(machine.memory.setCartridge(romLoader.getData()));
+        //11-op a,(hl) ends after about 74M cycles
+        while (machine.cycles < 100000000 && machine.step()
+               && serialOutput.getText().find("Passed") == std::string::npos
+               && serialOutput.getText().find("Failed") == std::string::npos) {
+        }
+        return serialOutput.getText();
+    }
+};
+
+TEST_P(CpuInstrsTest, interpreterPasses)
+{
+    EXPECT_NE(std::string::npos, runToResult(Cpu::CORE::INTERPRETER).find("Passed"));
+}
+
+TEST_P(CpuInstrsTest, referencePasses)
+{
+    EXPECT_NE(std::string::npos, runToResult(Cpu::CORE::REFERENCE).find("Passed"));
+}
+
+INSTANTIATE_TEST_CASE_P(CpuInstrs, CpuInstrsTest, ::testing::ValuesIn(cpuInstrsRoms), getRomTestName);
+
+TEST_F(InterpreterTest, illegalOpCodeLocksUp)
+{
+    for (Memory* memory : {&_reference.memory, &_machine.memory}) {
+        memory->writeInMemory(0x00, 0xc000);
+        memory->writeInMemory(0xD3, 0xc001);
+        memory->set16BitRegister(IMemory::REG16BIT::PC, 0xc000);
+    }
+    EXPECT_TRUE(_reference.step());
+    EXPECT_TRUE(_machine.step());
+    EXPECT_TRUE(_reference.step());
+    EXPECT_TRUE(_machine.step());
+    expectSameState();
+    EXPECT_TRUE(_machine.interruptHandler.isLocked());
+    EXPECT_EQ(0xc001, _machine.interruptHandler.getFault().pc);
+    EXPECT_EQ(0xD3, _machine.interruptHandler.getFault().opCode);
+    EXPECT_EQ(0xc001, _machine.memory.get16BitRegister(IMemory::REG16BIT::PC));
+    EXPECT_FALSE(_machine.step());
+}
+
+//the JIT only runs a block natively when no event is due before these
+TEST_F(InterpreterTest, maxCyclesBoundEveryOpCode)
+{
+    Interpreter& interpreter = _machine.getCore<Interpreter>();
+    Registers& registers = _machine.memory.getRegisters();
+    for (int opCode = 0; opCode < 0x100; opCode++) {
+        for (int operand = 0; operand < (opCode == 0xCB ? 0x100 : 1); operand++) {
+            for (uint8_t flags : {0x00, 0xF0}) {
+                registers.f = flags;
+                registers.pc = 0xc000;
+                registers.sp = 0xd000;
+                registers.hl = 0xc100;
+                EXPECT_GE(Interpreter::getMaxCycles(opCode),
+                          interpreter.execute(opCode, operand))
+                    << std::hex << opCode << " " << operand;
+            }
+        }
+    }
+}
@@ -16,10 +16,8 @@ class MockMemory : public IMemory
 {
 public:
 
-    MOCK_METHOD0(incrementDividerRegister, void());
     MOCK_METHOD0(incrementScanline, void());
-    MOCK_METHOD0(getCartridge, CartridgeData const());
-    MOCK_METHOD0(getReadOnlyMemory, RomData const());
+    MOCK_METHOD0(getCartridge, CartridgeData const &());
     MOCK_METHOD1(setCartridge, bool(CartridgeData const &));
     MOCK_METHOD0(getState, IMemory::State());
     MOCK_METHOD0(initializeMemory, void());
@@ -42,12 +40,9 @@ class InterruptHandlerTest : public ::testing::Test
 {
 public:
 
-    InterruptHandlerTest() {
-        _cartridge.fill(0);
-    }
+    InterruptHandlerTest() {}
 
     MockMemory _memory;
-    IMemory::CartridgeData _cartridge;
 
 
 };
@@ -167,8 +162,9 @@ TEST_F (InterruptHandlerTest, doInterruptWhenInterruptEnabled)
                         .WillOnce(Return(0x0100));
                     EXPECT_CALL(_memory, get16BitRegister(IMemory::REG16BIT::SP))
                         .WillOnce(Return(0xfffe));
-                    EXPECT_CALL(_memory, writeInMemory(0x01, 0xfffe));
-                    EXPECT_CALL(_memory, writeInMemory(0x00, 0xfffd));
+                    //pushed as CALL does, high byte first
+                    EXPECT_CALL(_memory, writeInMemory(0x01, 0xfffd));
+                    EXPECT_CALL(_memory, writeInMemory(0x00, 0xfffc));
                     EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::SP, 0xfffc));
                     EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::PC, serviceRoutineAdress));
                     interruptHandler.doInterrupt();
@@ -180,3 +176,24 @@ TEST_F (InterruptHandlerTest, doInterruptWhenInterruptEnabled)
     test(0x04, 0x04, 0x0050); //request timer interrupt
     test(0x10, 0x10, 0x0060); //request joypad interrupt
 }
+
+TEST_F (InterruptHandlerTest, servesOnlyTheHighestPriorityInterrupt)
+{
+    InterruptHandler interruptHandler(_memory);
+    interruptHandler.enableMasterSwitch();
+    EXPECT_CALL(_memory, readInMemory(0xff0f))
+        .WillOnce(Return(0x05));
+    EXPECT_CALL(_memory, readInMemory(0xffff))
+        .WillOnce(Return(0x05));
+    //the timer request stays for after the vBlanc RETI
+    EXPECT_CALL(_memory, writeInMemory(0x04, 0xff0f));
+    EXPECT_CALL(_memory, get16BitRegister(IMemory::REG16BIT::PC))
+        .WillOnce(Return(0x0100));
+    EXPECT_CALL(_memory, get16BitRegister(IMemory::REG16BIT::SP))
+        .WillOnce(Return(0xfffe));
+    EXPECT_CALL(_memory, writeInMemory(0x01, 0xfffd));
+    EXPECT_CALL(_memory, writeInMemory(0x00, 0xfffc));
+    EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::SP, 0xfffc));
+    EXPECT_CALL(_memory, set16BitRegister(IMemory::REG16BIT::PC, 0x0040));
+    interruptHandler.doInterrupt();
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "jit.hpp"
+#include "lockstep.hpp"
+
+//the Interpreter replays every block run by the JIT, both on the scheduler
+class JitTest : public LockstepTest
+{
+public:
+
+    JitTest()
+        :LockstepTest(Cpu::CORE::INTERPRETER, Cpu::CORE::JIT),
+         _jit(*_machine.jit)
+    {}
+
+    void loadLoop()
+    {
+        //INC A, LD B,A, JR back to INC A
+        std::vector<uint8_t> loop = {0x3C, 0x47, 0x18, 0xFC};
+        for (size_t index = 0; index < loop.size(); index++) {
+            _machine.memory.writeInMemory(loop[index], 0xc000 + index);
+        }
+        _machine.memory.set16BitRegister(IMemory::REG16BIT::PC, 0xc000);
+    }
+
+    Jit& _jit;
+};
+
+TEST_P(JitTest, sameStateAsInterpreter)
+{
+    runInLockstep(GetParam(), 50000);
+    if (Jit::isSupported()) {
+        EXPECT_LT(0u, _jit.getNativeStats().nativeRuns);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(CpuInstrs, JitTest, ::testing::ValuesIn(cpuInstrsRoms), getRomTestName);
+
+TEST_F(JitTest, compilesHotBlocks)
+{
+    loadLoop();
+    //a native run stops ahead of the next event, the rest of the loop follows
+    while (_machine.scheduler->getCycles() < 20u * (4 + 4 + 12)) {
+        _jit.run();
+    }
+    EXPECT_EQ(20, _machine.memory.get8BitRegister(IMemory::REG8BIT::A));
+    EXPECT_EQ(20, _machine.memory.get8BitRegister(IMemory::REG8BIT::B));
+    EXPECT_EQ(20u * (4 + 4 + 12), _machine.scheduler->getCycles());
+    EXPECT_EQ(60, _jit.getStats().instructions);
+    Jit::NativeStats const & stats = _jit.getNativeStats();
+    if (Jit::isSupported()) {
+        EXPECT_EQ(1, stats.compiledBlocks);
+        EXPECT_LT(0u, stats.nativeRuns);
+    }
+}
+
+TEST_F(JitTest, disabledJitInterpretsBlocks)
+{
+    loadLoop();
+    _jit.setEnabled(false);
+    for (int run = 0; run < 20; run++) {
+        _jit.run();
+    }
+    EXPECT_EQ(20, _machine.memory.get8BitRegister(IMemory::REG8BIT::A));
+    EXPECT_EQ(0, _jit.getNativeStats().compiledBlocks);
+    EXPECT_EQ(0, _jit.getNativeStats().nativeRuns);
+}
+
+//op, JP back to it: the flags of each native ALU and INC/DEC r
+//opCode against the Interpreter on the same registers, one block
+//per operand so that the immediates do not invalidate them
+TEST_F(JitTest, nativeAluMatchesInterpreter)
+{
+    if (!Jit::isSupported()) {
+        return;
+    }
+    std::vector<uint8_t> opCodes;
+    for (int opCode = 0x80; opCode <= 0xBF; opCode++) {
+        opCodes.push_back(opCode);
+    }
+    for (int opCode = 0xC6; opCode <= 0xFE; opCode += 8) {
+        opCodes.push_back(opCode);
+    }
+    for (int opCode = 0x04; opCode <= 0x3D; opCode += 8) {
+        if (opCode != 0x34) {
+            opCodes.push_back(opCode);
+            opCodes.push_back(opCode + 1);
+        }
+    }
+    std::vector<uint8_t> const values = {0x00, 0x01, 0x0F, 0xF0, 0xFF, 0x42};
+    Registers& registers = _machine.memory.getRegisters();
+    Registers& reference = _reference.memory.getRegisters();
+    Interpreter& interpreter = _reference.getCore<Interpreter>();
+    for (uint8_t opCode : opCodes) {
+        bool isImmediate = (opCode & 0xC7) == 0xC6;
+        bool isIndirect = 0x80 <= opCode && opCode < 0xC0 && (opCode & 0x07) == 0x06;
+        for (size_t index = 0; index < values.size(); index++) {
+            uint16_t pc = 0xc000 + index * 0x10;
+            std::vector<uint8_t> block = {opCode, values[index], 0xC3,
+                                          static_cast<uint8_t>(pc), static_cast<uint8_t>(pc >> 8)};
+            if (!isImmediate) {
+                block.erase(block.begin() + 1);
+            }
+            for (size_t byte = 0; byte < block.size(); byte++) {
+                _machine.memory.writeInMemory(block[byte], pc + byte);
+            }
+        }
+        uint64_t nativeRuns = _jit.getNativeStats().nativeRuns;
+        for (size_t index = 0; index < values.size(); index++) {
+            uint8_t value = values[index];
+            uint16_t pc = 0xc000 + index * 0x10;
+            for (uint8_t a : {0x00, 0x01, 0x0F, 0x10, 0x7F, 0x80, 0xFF, 0x3C}) {
+                for (uint8_t flags : {0x00, 0xF0}) {
+                    for (Memory* memory : {&_reference.memory, &_machine.memory}) {
+                        Registers& state = memory->getRegisters();
+                        state.f = flags;
+                        state.a = a;
+                        state.bc = value * 0x101;
+                        state.de = value * 0x101;
+                        state.hl = isIndirect ? 0xc100 : value * 0x101;
+                        state.pc = pc;
+                        memory->writeInMemory(value, 0xc100);
+                    }
+                    do {
+                        _jit.run();
+                    } while (registers.pc != pc);
+                    interpreter.execute(opCode, value);
+                    EXPECT_EQ(reference.af, registers.af)
+                        << std::hex << int(opCode) << " " << int(a) << " " << int(value) << " " << int(flags);
+                    EXPECT_EQ(reference.bc, registers.bc) << std::hex << int(opCode);
+                    EXPECT_EQ(reference.de, registers.de) << std::hex << int(opCode);
+                    EXPECT_EQ(reference.hl, registers.hl) << std::hex << int(opCode);
+                }
+            }
+        }
+        EXPECT_LT(nativeRuns, _jit.getNativeStats().nativeRuns) << std::hex << int(opCode);
+    }
+}
@@ -0,0 +1,214 @@
+#ifndef _LOCKSTEP_
+#define _LOCKSTEP_
+
+#include <gtest/gtest.h>
+#include <cctype>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fileio.hpp"
+#include "romloader.hpp"
+#include "cpu.hpp"
+
+//the cpu_instrs roms each core is compared on, see GB_TEST_ROM_DIR
+static std::vector<std::string> const cpuInstrsRoms = {
+    "01-special.gb", "02-interrupts.gb", "03-op sp,hl.gb", "04-op r,imm.gb",
+    "05-op rp.gb", "06-ld r,r.gb", "07-jr,jp,call,ret,rst.gb", "08-misc instrs.gb",
+    "09-op r,r.gb", "10-bit ops.gb", "11-op a,(hl).gb"};
+
+//"03-op sp,hl.gb" -> rom03opsphl, test names only take letters, digits and _
+inline std::string getRomTestName(::testing::TestParamInfo<std::string> const & info)
+{
+    std::string name = "rom";
+    for (char character : info.param.substr(0, info.param.find_last_of('.'))) {
+        if (std::isalnum(static_cast<unsigned char>(character))) {
+            name += character;
+        }
+    }
+    return name;
+}
+
+//The components wired as in Cpu, one core driving them through the scheduler.
+//A polling machine has no scheduler, it updates them after every
+//instruction as Cpu::nextStep used to.
+struct LockstepMachine
+{
+    explicit LockstepMachine(Cpu::CORE coreType, bool isPolling = false)
+        :interruptHandler(memory),
+         timer(memory, interruptHandler),
+         graphics(memory, interruptHandler),
+         isPolling(isPolling)
+    {
+        if (!isPolling) {
+            scheduler.reset(new BasicScheduler<Memory>(memory, interruptHandler, timer, graphics));
+        }
+        if (coreType == Cpu::CORE::INTERPRETER) {
+            core.reset(new Interpreter(memory, interruptHandler));
+        }
+        else if (coreType == Cpu::CORE::BLOCK_CACHE) {
+            blockCache = new BlockCache(memory, interruptHandler);
+            blockCache->setScheduler(scheduler.get());
+            core.reset(blockCache);
+        }
+        else if (coreType == Cpu::CORE::JIT) {
+            jit = new Jit(memory, interruptHandler);
+            jit->setScheduler(scheduler.get());
+            blockCache = jit;
+            core.reset(jit);
+        }
+        else {
+            memory.setLazyFlags(true);
+            core.reset(new BasicInstructionHandler<Memory>(memory, interruptHandler));
+        }
+    }
+
+    template <class CORE>
+    CORE& getCore()
+    {
+        return static_cast<CORE&>(*core);
+    }
+
+    //same sequence as Cpu::step without the idle loop skip,
+    //false once an illegal opCode hung the CPU
+    bool step()
+    {
+        if (interruptHandler.isLocked()) {
+            return false;
+        }
+        if (interruptHandler.isHalted()) {
+            update(isPolling ? 4 : std::max(4, (scheduler->getCyclesToNextEvent() + 3) / 4 * 4));
+            return true;
+        }
+        if (blockCache != nullptr) {
+            cycles += blockCache->run();
+            return true;
+        }
+        uint8_t opCode = memory.readInMemory(memory.get16BitRegister(IMemory::REG16BIT::PC));
+        update(core->doInstruction(opCode));
+        return true;
+    }
+
+    void update(int stepCycles)
+    {
+        cycles += stepCycles;
+        if (isPolling) {
+            timer.update(stepCycles);
+            graphics.update(stepCycles);
+            interruptHandler.doInterrupt();
+        }
+        else {
+            scheduler->update(stepCycles);
+        }
+    }
+
+    Memory memory;
+    BasicInterruptHandler<Memory> interruptHandler;
+    BasicTimer<Memory> timer;
+    BasicGraphics<Memory> graphics;
+    std::unique_ptr<BasicScheduler<Memory>> scheduler;
+    std::unique_ptr<IInstructionHandler> core;
+    //same objects as core for the block cache and the JIT
+    BlockCache* blockCache = nullptr;
+    Jit* jit = nullptr;
+    bool const isPolling;
+    uint64_t cycles = 0;
+};
+
+//The cpu_instrs roms print their result on the serial port, each byte
+//written to SB 0xff01 is sent by writing 0x81 to SC 0xff02
+class SerialOutput : public IIoHandler
+{
+public:
+
+    explicit SerialOutput(Memory& memory)
+        :_memory(memory)
+    {
+        _memory.setIoHandler(0xff02, this);
+    }
+
+    //the transfer is done at once, no link cable answers
+    uint8_t writeIo(uint16_t, uint8_t data, uint8_t) override
+    {
+        if (data == 0x81) {
+            _text += static_cast<char>(_memory.readInMemory(0xff01));
+        }
+        return data & 0x7f;
+    }
+
+    std::string const & getText() const
+    {
+        return _text;
+    }
+
+private:
+
+    Memory& _memory;
+    std::string _text;
+};
+
+//Runs a core next to a reference core on a rom. The reference catches up
+//with each step of the core, the cores running several instructions a step
+//are compared at the end of each of them.
+class LockstepTest : public ::testing::TestWithParam<std::string>
+{
+public:
+
+    //a polling reference checks the scheduler itself
+    LockstepTest(Cpu::CORE referenceCore, Cpu::CORE core, bool isPollingReference = false)
+        :_reference(referenceCore, isPollingReference),
+         _machine(core)
+    {}
+
+    void expectSameState()
+    {
+        Registers& reference = _reference.memory.getRegisters();
+        Registers& machine = _machine.memory.getRegisters();
+        EXPECT_EQ(_reference.cycles, _machine.cycles);
+        EXPECT_EQ(reference.af, machine.af);
+        EXPECT_EQ(reference.bc, machine.bc);
+        EXPECT_EQ(reference.de, machine.de);
+        EXPECT_EQ(reference.hl, machine.hl);
+        EXPECT_EQ(reference.sp, machine.sp);
+        EXPECT_EQ(reference.pc, machine.pc);
+        EXPECT_EQ(_reference.interruptHandler.isMasterSwitchEnabled(),
+                  _machine.interruptHandler.isMasterSwitchEnabled());
+        EXPECT_EQ(_reference.interruptHandler.isHalted(),
+                  _machine.interruptHandler.isHalted());
+        EXPECT_EQ(_reference.interruptHandler.isLocked(),
+                  _machine.interruptHandler.isLocked());
+    }
+
+    void runInLockstep(std::string const & romName, int stepsToRun)
+    {
+        FileIO fileIO;
+        RomLoader romLoader(fileIO);
+        ASSERT_TRUE(romLoader.load(GB_TEST_ROM_DIR + romName));
+        ASSERT_TRUE(_reference.memory.setCartridge(romLoader.getData()));
+        ASSERT_TRUE(_machine.memory.setCartridge(romLoader.getData()));
+
+        for (int step = 0; step < stepsToRun; step++) {
+            bool isRunning = _machine.step();
+            while (_reference.cycles < _machine.cycles && _reference.step()) {
+            }
+            expectSameState();
+            if (::testing::Test::HasFailure()) {
+                FAIL() << romName << " diverged at step " << step;
+            }
+            if (!isRunning) {
+                break;
+            }
+            if (step % 0x400 == 0) {
+                ASSERT_EQ(_reference.memory.getReadOnlyMemory(), _machine.memory.getReadOnlyMemory())
+                    << romName << " diverged at step " << step;
+            }
+        }
+        ASSERT_EQ(_reference.memory.getReadOnlyMemory(), _machine.memory.getReadOnlyMemory());
+    }
+
+protected:
+
+    LockstepMachine _reference;
+    LockstepMachine _machine;
+};
+#endif /*LOCKSTEP*/
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <iostream>
+#include <memory>
+#include <unistd.h>
 
 #include "memory.hpp"
+#include "interupthandler.hpp"
+#include "timer.hpp"
+#include "graphics.hpp"
 #include "iromloader.hpp"
 #include "ifileio.hpp"
 
@@ -33,10 +38,10 @@ class MemoryTest : public ::testing::Test
 public:
 
     MemoryTest() {
+        std::vector<uint8_t> cartridge(0x200000);
         uint8_t hex = 0;
-        for (size_t index = 0x0; index < IMemory::cartridgeSize; index++) {
-            _emptyCartridge[index] = 0x0;
-            _cartridge[index] = hex;
+        for (size_t index = 0x0; index < cartridge.size(); index++) {
+            cartridge[index] = hex;
             if (index < 0x4000) {
                 _bank0[index] = hex;
             }
@@ -47,6 +52,8 @@ public:
                 hex++;
             }
         }
+        _cartridge = IMemory::CartridgeData(std::move(cartridge));
+        _emptyCartridge = IMemory::CartridgeData(std::vector<uint8_t>(0x200000, 0x0));
     }
 
     MockFileIo _fileIO;
@@ -57,15 +64,6 @@ public:
     std::array<uint8_t, IMemory::bank0Size> _bank0;
 };
 
-TEST_F(MemoryTest, incrementDivderRegister)
-{
-    Memory mem;
-
-    uint8_t currentValue = mem.readInMemory(0xff04);
-    mem.incrementDividerRegister();
-    EXPECT_EQ(currentValue + 1, mem.readInMemory(0xff04));
-}
-
 TEST_F (MemoryTest, addNewValidCartridge)
 {
     Memory mem;
@@ -76,7 +74,7 @@ TEST_F (MemoryTest, addNewValidCartridge)
         EXPECT_EQ(_cartridge[i], cartridge[i]);
     }
 
-    IMemory::RomData rom = mem.getReadOnlyMemory();
+    MemoryView rom = mem.getReadOnlyMemory();
     for (size_t i = 0; i < _bank0.size(); i++) {
         EXPECT_EQ(_bank0[i], rom[i]);
     }
@@ -94,7 +92,9 @@ TEST_F (MemoryTest, getCartridge)
 
     EXPECT_TRUE(mem.setCartridge(_cartridge));
 
+    //the bytes are shared, not copied
     IMemory::CartridgeData cartridge = mem.getCartridge();
+    EXPECT_EQ(_cartridge.data(), cartridge.data());
     for (size_t i = 0; i < cartridge.size(); i++) {
         EXPECT_EQ(_cartridge[i], cartridge[i]);
     }
@@ -105,7 +105,7 @@ TEST_F (MemoryTest, getRom)
     Memory mem;
     EXPECT_TRUE(mem.setCartridge(_cartridge));
 
-    IMemory::RomData rom = mem.getReadOnlyMemory();
+    MemoryView rom = mem.getReadOnlyMemory();
     for (size_t i = 0; i < _bank0.size(); i++) {
         EXPECT_EQ(_bank0[i], rom[i]);
     }
@@ -119,13 +119,66 @@ TEST_F (MemoryTest, writeInMemory)
     Memory mem;
 
     EXPECT_FALSE(mem.writeInMemory(0xff, 0x1000));
-    IMemory::RomData rom = mem.getReadOnlyMemory();
+    MemoryView rom = mem.getReadOnlyMemory();
     EXPECT_EQ(0, rom[0x8001]);
     EXPECT_TRUE(mem.writeInMemory(0xff, 0x8001));
     rom = mem.getReadOnlyMemory();
     EXPECT_EQ(0xff, rom[0x8001]);
 }
 
+TEST_F (MemoryTest, readOnlyMemoryIsAView)
+{
+    Memory mem;
+    EXPECT_TRUE(mem.setCartridge(_cartridge));
+
+    //nothing is copied, the view reads the memory as it is now
+    MemoryView rom = mem.getReadOnlyMemory();
+    size_t const romSize = IMemory::romSize;
+    EXPECT_EQ(romSize, rom.size());
+    EXPECT_EQ(0, rom[0xc000]);
+    mem.writeInMemory(0x42, 0xc000);
+    EXPECT_EQ(0x42, rom[0xc000]);
+    EXPECT_EQ(0x42, mem.getState().readOnlyMemory[0xe000]);
+
+    Memory other;
+    EXPECT_TRUE(other.setCartridge(_cartridge));
+    EXPECT_NE(rom, other.getReadOnlyMemory());
+    other.writeInMemory(0x42, 0xc000);
+    EXPECT_EQ(rom, other.getReadOnlyMemory());
+}
+
+TEST_F (MemoryTest, copyMemoryMatchesTheView)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    EXPECT_TRUE(mem->setCartridge(_cartridge));
+    mem->writeInMemory(0x42, 0xc000);
+    mem->writeInMemory(0x24, 0xff80);
+    std::unique_ptr<IMemory::RomData> snapshot(new IMemory::RomData);
+    mem->copyMemory(*snapshot);
+    MemoryView rom = mem->getReadOnlyMemory();
+    for (size_t adress = 0; adress < rom.size(); adress++) {
+        ASSERT_EQ(rom[adress], (*snapshot)[adress]) << std::hex << adress;
+    }
+}
+
+TEST_F (MemoryTest, registerStateMatchesGetters)
+{
+    Memory mem;
+    EXPECT_TRUE(mem.setCartridge(_cartridge));
+    mem.set16BitRegister(IMemory::REG16BIT::PC, 0xc010);
+    mem.set16BitRegister(IMemory::REG16BIT::HL, 0x1234);
+    mem.writeInMemory(0x3c, 0xc010);
+    mem.writeInMemory(0x05, 0xffff);
+
+    IMemory::RegisterState state = mem.getRegisterState();
+    EXPECT_EQ(0xc010, state.registers.pc);
+    EXPECT_EQ(0x1234, state.registers.hl);
+    EXPECT_EQ(mem.get16BitRegister(IMemory::REG16BIT::AF), state.registers.af);
+    EXPECT_EQ(0x3c, state.opCode);
+    EXPECT_EQ(0x05, state.interruptEnable);
+    EXPECT_EQ(mem.getState().opCode, state.opCode);
+}
+
 TEST_F (MemoryTest, setAndGet8BitRegisters)
 {
     Memory mem;
@@ -275,3 +328,365 @@ TEST_F(MemoryTest, setAndUnsetBitIn8BitRegister)
 }
 
 
+
+TEST_F(MemoryTest, lazyFlagsAreComputedWhenRead)
+{
+    Memory mem;
+    mem.setLazyFlags(true);
+
+    mem.setAluFlags(IMemory::ALU_OPERATION::SUB, 0x10, 0x10);
+    EXPECT_TRUE(mem.isSetFlag(IMemory::FLAG::Z));
+    EXPECT_TRUE(mem.isSetFlag(IMemory::FLAG::N));
+    EXPECT_FALSE(mem.isSetFlag(IMemory::FLAG::H));
+    EXPECT_FALSE(mem.isSetFlag(IMemory::FLAG::C));
+
+    mem.setAluFlags(IMemory::ALU_OPERATION::ADD, 0x0F, 0x01);
+    EXPECT_EQ(0x20, mem.get8BitRegister(IMemory::REG8BIT::F));
+}
+
+TEST_F(MemoryTest, lazyIncDecKeepPreviousCarry)
+{
+    Memory mem;
+    mem.setLazyFlags(true);
+
+    mem.setAluFlags(IMemory::ALU_OPERATION::SUB, 0x00, 0x01);
+    mem.setAluFlags(IMemory::ALU_OPERATION::INC, 0xFF, 0x01);
+    EXPECT_EQ(0xB0, mem.get16BitRegister(IMemory::REG16BIT::AF) & 0xFF);
+}
+
+TEST_F(MemoryTest, writingFDropsPendingFlags)
+{
+    Memory mem;
+    mem.setLazyFlags(true);
+
+    mem.setAluFlags(IMemory::ALU_OPERATION::ADD, 0x00, 0x00);
+    mem.set8BitRegister(IMemory::REG8BIT::F, 0x10);
+    EXPECT_EQ(0x10, mem.get8BitRegister(IMemory::REG8BIT::F));
+}
+
+TEST_F(MemoryTest, lazyAndEagerFlagsMatch)
+{
+    Memory eager;
+    Memory lazy;
+    lazy.setLazyFlags(true);
+
+    for (auto operation : {IMemory::ALU_OPERATION::ADD, IMemory::ALU_OPERATION::ADC,
+                IMemory::ALU_OPERATION::SUB, IMemory::ALU_OPERATION::SBC,
+                IMemory::ALU_OPERATION::INC, IMemory::ALU_OPERATION::DEC}) {
+        for (int value = 0; value < 0x100; value++) {
+            for (int operand = 0; operand < 0x100; operand += 7) {
+                bool carry = (value + operand) & 0x01;
+                eager.setAluFlags(operation, value, operand, carry);
+                lazy.setAluFlags(operation, value, operand, carry);
+                ASSERT_EQ(eager.get8BitRegister(IMemory::REG8BIT::F),
+                          lazy.get8BitRegister(IMemory::REG8BIT::F));
+            }
+        }
+    }
+}
+
+TEST_F(MemoryTest, setAndUnsetBitKeepOtherBits)
+{
+    Memory mem;
+    mem.set8BitRegister(IMemory::REG8BIT::B, 0x00);
+    mem.setBitInRegister(0, IMemory::REG8BIT::B);
+    mem.setBitInRegister(3, IMemory::REG8BIT::B);
+    EXPECT_EQ(0x09, mem.get8BitRegister(IMemory::REG8BIT::B));
+    mem.unsetBitInRegister(0, IMemory::REG8BIT::B);
+    EXPECT_EQ(0x08, mem.get8BitRegister(IMemory::REG8BIT::B));
+}
+
+TEST_F(MemoryTest, pagesMapRomAndEchoRam)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    std::vector<uint8_t> cartridge(_cartridge.begin(), _cartridge.end());
+    cartridge[0x4321] = 0xab;
+    EXPECT_TRUE(mem->setCartridge(IMemory::CartridgeData(std::move(cartridge))));
+    EXPECT_EQ(0xab, mem->readInMemory(0x4321));
+    EXPECT_FALSE(mem->writeInMemory(0x12, 0x4321));
+    EXPECT_EQ(0xab, mem->readInMemory(0x4321));
+
+    //both ways, echo ram is the work ram
+    EXPECT_TRUE(mem->writeInMemory(0x5a, 0xc123));
+    EXPECT_EQ(0x5a, mem->readInMemory(0xe123));
+    EXPECT_TRUE(mem->writeInMemory(0xa5, 0xfd00));
+    EXPECT_EQ(0xa5, mem->readInMemory(0xdd00));
+    EXPECT_EQ(0xa5, mem->getReadOnlyMemory()[0xfd00]);
+
+    //the restricted area still ignores writes
+    EXPECT_TRUE(mem->writeInMemory(0x42, 0xfea0));
+    EXPECT_EQ(0x00, mem->readInMemory(0xfea0));
+}
+
+class WakeCounter : public IScheduler
+{
+public:
+    void wake(EVENT event) override
+    {
+        (void)event;
+        _wakes++;
+    }
+    uint64_t getCycles() override
+    {
+        return 0;
+    }
+    int _wakes = 0;
+};
+
+TEST_F(MemoryTest, highRamSkipsTheIoPath)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    WakeCounter scheduler;
+    mem->setScheduler(&scheduler);
+    for (int adress = 0xff80; adress < 0xffff; adress++) {
+        EXPECT_TRUE(mem->writeInMemory(adress & 0xff, adress));
+    }
+    for (int adress = 0xff80; adress < 0xffff; adress++) {
+        EXPECT_EQ(adress & 0xff, mem->readInMemory(adress));
+    }
+    EXPECT_EQ(0, scheduler._wakes);
+
+    //IE still wakes the interrupts
+    mem->writeInMemory(0x01, 0xffff);
+    EXPECT_EQ(0x01, mem->readInMemory(0xffff));
+    EXPECT_EQ(1, scheduler._wakes);
+    mem->setScheduler(nullptr);
+}
+
+//joypad like, the upper bits read as set and only the selection is written
+class SelectHandler : public IIoHandler
+{
+public:
+
+    uint8_t readIo(uint16_t, uint8_t value) override
+    {
+        return value | 0xcf;
+    }
+
+    uint8_t writeIo(uint16_t, uint8_t data, uint8_t) override
+    {
+        return data & 0x30;
+    }
+};
+
+TEST_F(MemoryTest, ioAccessesGoThroughTheirHandler)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    SelectHandler handler;
+    mem->setIoHandler(0xff00, &handler);
+    EXPECT_TRUE(mem->writeInMemory(0x1f, 0xff00));
+    EXPECT_EQ(0xdf, mem->readInMemory(0xff00));
+    EXPECT_EQ(0xdf, mem->getReadOnlyMemory()[0xff00]);
+    EXPECT_THROW(mem->setIoHandler(0xff80, &handler), Memory::MemoryException);
+
+    {
+        BasicInterruptHandler<Memory> interruptHandler(*mem);
+        BasicTimer<Memory> timer(*mem, interruptHandler);
+        BasicGraphics<Memory> graphics(*mem, interruptHandler);
+        timer.update(0x300);
+        mem->incrementScanline();
+        EXPECT_TRUE(mem->writeInMemory(0x42, 0xff04));
+        EXPECT_TRUE(mem->writeInMemory(0x42, 0xff44));
+        EXPECT_EQ(0x00, mem->readInMemory(0xff04));
+        EXPECT_EQ(0x00, mem->readInMemory(0xff44));
+
+        for (int index = 0; index < 0xa0; index++) {
+            mem->writeInMemory(index + 1, 0xc100 + index);
+        }
+        EXPECT_TRUE(mem->writeInMemory(0xc1, 0xff46));
+        for (int index = 0; index < 0xa0; index++) {
+            ASSERT_EQ(index + 1, mem->readInMemory(0xfe00 + index));
+        }
+    }
+    //plain bytes once the components are gone
+    EXPECT_TRUE(mem->writeInMemory(0x42, 0xff04));
+    EXPECT_EQ(0x42, mem->readInMemory(0xff04));
+}
+
+//each bank starts with its number
+IMemory::CartridgeData makeBankedCartridge(uint8_t type, uint8_t romSize, uint8_t ramSize,
+                                           size_t size = 0x200000)
+{
+    std::vector<uint8_t> cartridge(size);
+    for (size_t bank = 0; bank < size / 0x4000; bank++) {
+        cartridge[bank * 0x4000] = bank;
+        cartridge[bank * 0x4000 + 1] = bank >> 8;
+    }
+    cartridge[0x147] = type;
+    cartridge[0x148] = romSize;
+    cartridge[0x149] = ramSize;
+    return IMemory::CartridgeData(std::move(cartridge));
+}
+
+TEST_F(MemoryTest, mbc1SwitchesRomAndRamBanks)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    //2MB rom, 32KB ram
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x03, 0x06, 0x03)));
+    EXPECT_EQ(0, mem->readInMemory(0x0000));
+    EXPECT_EQ(1, mem->readInMemory(0x4000));
+
+    EXPECT_FALSE(mem->writeInMemory(0x05, 0x2000));
+    EXPECT_EQ(5, mem->readInMemory(0x4000));
+    //bank 0 reads as bank 1, the upper bits come from 0x4000
+    mem->writeInMemory(0x00, 0x2000);
+    EXPECT_EQ(1, mem->readInMemory(0x4000));
+    mem->writeInMemory(0x02, 0x4000);
+    EXPECT_EQ(0x41, mem->readInMemory(0x4000));
+    EXPECT_EQ(0, mem->readInMemory(0x0000));
+    mem->writeInMemory(0x01, 0x6000);
+    EXPECT_EQ(0x40, mem->readInMemory(0x0000));
+
+    //ram disabled until 0x0a is written
+    mem->writeInMemory(0x12, 0xa000);
+    EXPECT_EQ(0xff, mem->readInMemory(0xa000));
+    mem->writeInMemory(0x0a, 0x0000);
+    mem->writeInMemory(0x12, 0xa000);
+    mem->writeInMemory(0x01, 0x4000);
+    mem->writeInMemory(0x34, 0xa000);
+    EXPECT_EQ(0x34, mem->readInMemory(0xa000));
+    mem->writeInMemory(0x02, 0x4000);
+    EXPECT_EQ(0x12, mem->readInMemory(0xa000));
+    mem->writeInMemory(0x00, 0x0000);
+    EXPECT_EQ(0xff, mem->readInMemory(0xa000));
+}
+
+TEST_F(MemoryTest, mbc3LatchesItsClock)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x10, 0x06, 0x03)));
+    mem->writeInMemory(0x7f, 0x2000);
+    EXPECT_EQ(0x7f, mem->readInMemory(0x4000));
+
+    mem->writeInMemory(0x0a, 0x0000);
+    //halted, then 1 day 2:03:04
+    mem->writeInMemory(0x0c, 0x4000);
+    mem->writeInMemory(0x40, 0xa000);
+    std::vector<uint8_t> const clock = {0x04, 0x03, 0x02, 0x01};
+    for (size_t index = 0; index < clock.size(); index++) {
+        mem->writeInMemory(0x08 + index, 0x4000);
+        mem->writeInMemory(clock[index], 0xa000);
+    }
+    mem->writeInMemory(0x00, 0x6000);
+    mem->writeInMemory(0x01, 0x6000);
+    for (size_t index = 0; index < clock.size(); index++) {
+        mem->writeInMemory(0x08 + index, 0x4000);
+        EXPECT_EQ(clock[index], mem->readInMemory(0xa000));
+    }
+    mem->writeInMemory(0x0c, 0x4000);
+    EXPECT_EQ(0x40, mem->readInMemory(0xa000));
+
+    //back on the ram
+    mem->writeInMemory(0x01, 0x4000);
+    mem->writeInMemory(0x56, 0xa000);
+    EXPECT_EQ(0x56, mem->readInMemory(0xa000));
+}
+
+TEST_F(MemoryTest, mbc3ClockStartsWithTheCartridge)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x10, 0x06, 0x03)));
+    mem->writeInMemory(0x0a, 0x0000);
+    mem->writeInMemory(0x00, 0x6000);
+    mem->writeInMemory(0x01, 0x6000);
+    //a second at most went by, no day nor carry
+    mem->writeInMemory(0x08, 0x4000);
+    EXPECT_GE(1, mem->readInMemory(0xa000));
+    for (uint8_t reg = 0x09; reg <= 0x0c; reg++) {
+        mem->writeInMemory(reg, 0x4000);
+        EXPECT_EQ(0, mem->readInMemory(0xa000)) << std::hex << static_cast<int>(reg);
+    }
+}
+
+TEST_F(MemoryTest, mbc5SwitchesNineBitRomBanks)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x19, 0x06, 0x00)));
+    //bank 0 can be mapped at 0x4000
+    mem->writeInMemory(0x00, 0x2000);
+    EXPECT_EQ(0, mem->readInMemory(0x4000));
+    mem->writeInMemory(0x45, 0x2000);
+    EXPECT_EQ(0x45, mem->readInMemory(0x4000));
+    //the ninth bit wraps on this 2MB rom
+    mem->writeInMemory(0x01, 0x3000);
+    EXPECT_EQ(0x45, mem->readInMemory(0x4000));
+    mem->writeInMemory(0x0a, 0x0000);
+    EXPECT_EQ(0xff, mem->readInMemory(0xa000));
+}
+
+TEST_F(MemoryTest, mbc5SwitchesSixteenRamBanks)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    //128KB ram
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x1A, 0x06, 0x04)));
+    mem->writeInMemory(0x0a, 0x0000);
+    for (uint8_t bank = 0; bank < 16; bank++) {
+        mem->writeInMemory(bank, 0x4000);
+        mem->writeInMemory(0x10 + bank, 0xa000);
+    }
+    for (uint8_t bank = 0; bank < 16; bank++) {
+        mem->writeInMemory(bank, 0x4000);
+        EXPECT_EQ(0x10 + bank, mem->readInMemory(0xa000)) << static_cast<int>(bank);
+    }
+}
+
+TEST_F(MemoryTest, mbc5MapsAnEightMegabyteRom)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x19, 0x08, 0x00, 0x800000)));
+    mem->writeInMemory(0xff, 0x2000);
+    mem->writeInMemory(0x01, 0x3000);
+    EXPECT_EQ(0xff, mem->readInMemory(0x4000));
+    EXPECT_EQ(0x01, mem->readInMemory(0x4001));
+}
+
+TEST_F(MemoryTest, shortRomIsPadded)
+{
+    std::unique_ptr<Memory> mem(new Memory);
+    std::vector<uint8_t> cartridge(0x150, 0x00);
+    cartridge[0x100] = 0x3C;
+    ASSERT_TRUE(mem->setCartridge(IMemory::CartridgeData(std::move(cartridge))));
+    EXPECT_EQ(0x3C, mem->readInMemory(0x0100));
+    EXPECT_EQ(0x00, mem->readInMemory(0x0150));
+    EXPECT_EQ(0x00, mem->readInMemory(0x7fff));
+    EXPECT_EQ(0x8000u, mem->getCartridge().size());
+}
+
+TEST_F(MemoryTest, batteryRamIsMappedFromTheSaveFile)
+{
+    char path[] = "/tmp/gbSaveXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_LE(0, fd);
+    close(fd);
+    std::shared_ptr<SaveFile> saveFile(new SaveFile);
+    ASSERT_TRUE(saveFile->open(path, 0x8000));
+    unlink(path);
+    saveFile->getData()[0x2010] = 0x77;
+
+    std::unique_ptr<Memory> mem(new Memory);
+    //mbc1 without a battery
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x02, 0x06, 0x03)));
+    EXPECT_EQ(0u, mem->getBatteryRamSize());
+    EXPECT_FALSE(mem->setSaveFile(saveFile));
+
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x03, 0x06, 0x03)));
+    EXPECT_EQ(0x8000u, mem->getBatteryRamSize());
+    ASSERT_TRUE(mem->setSaveFile(saveFile));
+    mem->writeInMemory(0x0a, 0x0000);
+    mem->writeInMemory(0x01, 0x6000);
+    mem->writeInMemory(0x01, 0x4000);
+    EXPECT_EQ(0x77, mem->readInMemory(0xa010));
+    EXPECT_FALSE(saveFile->isDirty());
+
+    mem->writeInMemory(0x42, 0xa011);
+    EXPECT_EQ(0x42, mem->readInMemory(0xa011));
+    EXPECT_EQ(0x42, saveFile->getData()[0x2011]);
+    EXPECT_TRUE(saveFile->isDirty());
+
+    //the next cartridge gets its ram back
+    ASSERT_TRUE(mem->setCartridge(makeBankedCartridge(0x03, 0x06, 0x03)));
+    mem->writeInMemory(0x0a, 0x0000);
+    mem->writeInMemory(0x01, 0x6000);
+    mem->writeInMemory(0x01, 0x4000);
+    EXPECT_EQ(0, mem->readInMemory(0xa010));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "memory.hpp"
+#include "interupthandler.hpp"
+#include "instructionhandler.hpp"
+#include "interpreter.hpp"
+#include "blockcache.hpp"
+#include "profiler.hpp"
+
+TEST(ProfilerTest, countsOpCodesCyclesAndPcs)
+{
+    Profiler profiler;
+    profiler.record(0x0100, 0x00, 0x00, 4);
+    profiler.record(0x0101, 0x3C, 0x00, 4);
+    profiler.record(0x0100, 0x00, 0xFF, 4);
+    profiler.record(0x0102, 0xCB, 0x37, 8);
+
+    EXPECT_EQ(2u, profiler.getCounter(0x00).executions);
+    EXPECT_EQ(8u, profiler.getCounter(0x00).cycles);
+    EXPECT_EQ(0u, profiler.getCounter(0xCB).executions);
+    EXPECT_EQ(1u, profiler.getCbCounter(0x37).executions);
+    EXPECT_EQ(8u, profiler.getCbCounter(0x37).cycles);
+    EXPECT_EQ(0u, profiler.getCbCounter(0xFF).executions);
+    EXPECT_EQ(2u, profiler.getPcHits(0x0100));
+    EXPECT_EQ(4u, profiler.getTotal().executions);
+    EXPECT_EQ(20u, profiler.getTotal().cycles);
+
+    profiler.reset();
+    EXPECT_EQ(0u, profiler.getTotal().executions);
+    EXPECT_EQ(0u, profiler.getPcHits(0x0100));
+}
+
+TEST(ProfilerTest, writesCsvAndJson)
+{
+    Profiler profiler;
+    profiler.record(0x0100, 0x00, 0x00, 4);
+    profiler.record(0x0101, 0xCB, 0x37, 12);
+
+    std::ostringstream csv;
+    profiler.writeCsv(csv);
+    EXPECT_EQ("kind,code,executions,cycles,share\n"
+              "base,00,1,4,25\n"
+              "cb,37,1,12,75\n"
+              "pc,0100,1,,\n"
+              "pc,0101,1,,\n", csv.str());
+
+    std::ostringstream json;
+    profiler.writeJson(json);
+    EXPECT_EQ("{\n  \"cycles\": 16,\n"
+              "  \"base\": {\n    \"00\": {\"executions\": 1, \"cycles\": 4, \"share\": 25}\n  },\n"
+              "  \"cb\": {\n    \"37\": {\"executions\": 1, \"cycles\": 12, \"share\": 75}\n  },\n"
+              "  \"pc\": {\n    \"0100\": 1,\n    \"0101\": 1\n  }\n}\n", json.str());
+}
+
+#if GB_PROFILE
+template <class CORE>
+struct ProfiledMachine
+{
+    ProfiledMachine()
+        :interruptHandler(memory),
+         core(memory, interruptHandler)
+    {
+        core.setProfiler(&profiler);
+    }
+
+    void run(std::vector<uint8_t> const & program)
+    {
+        for (size_t index = 0; index < program.size(); index++) {
+            memory.writeInMemory(program[index], 0xc000 + index);
+        }
+        memory.set16BitRegister(IMemory::REG16BIT::PC, 0xc000);
+        while (memory.get16BitRegister(IMemory::REG16BIT::PC) != 0xc000 + program.size()) {
+            core.doInstruction(memory.readInMemory(memory.get16BitRegister(IMemory::REG16BIT::PC)));
+        }
+    }
+
+    Memory memory;
+    BasicInterruptHandler<Memory> interruptHandler;
+    CORE core;
+    Profiler profiler;
+};
+
+TEST(ProfilerTest, coresRecordTheSameProfile)
+{
+    //ld b,03 / swap a / dec b / jr nz,-5
+    std::vector<uint8_t> const program = {0x06, 0x03, 0xCB, 0x37, 0x05, 0x20, 0xFB};
+    ProfiledMachine<BasicInstructionHandler<Memory>> reference;
+    ProfiledMachine<Interpreter> interpreter;
+    ProfiledMachine<BlockCache> blockCache;
+    reference.run(program);
+    interpreter.run(program);
+    blockCache.run(program);
+
+    EXPECT_EQ(3u, reference.profiler.getCounter(0x05).executions);
+    EXPECT_EQ(3u, reference.profiler.getCbCounter(0x37).executions);
+    EXPECT_EQ(3u, reference.profiler.getPcHits(0xc005));
+    for (Profiler const * profiler : {&interpreter.profiler, &blockCache.profiler}) {
+        for (int opCode = 0; opCode < 0x100; opCode++) {
+            EXPECT_EQ(reference.profiler.getCounter(opCode).cycles, profiler->getCounter(opCode).cycles);
+            EXPECT_EQ(reference.profiler.getCbCounter(opCode).cycles, profiler->getCbCounter(opCode).cycles);
+        }
+        EXPECT_EQ(reference.profiler.getTotal().executions, profiler->getTotal().executions);
+        EXPECT_EQ(reference.profiler.getPcHits(0xc002), profiler->getPcHits(0xc002));
+    }
+}
+#endif
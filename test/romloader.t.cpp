@@ -1,10 +1,13 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <algorithm>
+#include <unistd.h>
 
 #include "romloader.hpp"
 #include "ifileio.hpp"
 
 using ::testing::_;
+using ::testing::DoAll;
 using ::testing::Return;
 using ::testing::SetArgPointee;
 using ::testing::SetArrayArgument;
@@ -47,6 +50,7 @@ TEST_F (RomLoaderTest, loadValidFile)
     bool isLoaded = romLoader.load(fileName);
 
     IMemory::CartridgeData data = romLoader.getData();
+    EXPECT_EQ(512u + 35u, data.size());
     for (int i = 0x0000; i < 512; i++) {
         EXPECT_EQ(data[i], 7);
     }
@@ -83,3 +87,50 @@ TEST_F (RomLoaderTest, loadEmptyFile)
 
     EXPECT_FALSE(isLoaded);
 }
+
+TEST_F (RomLoaderTest, loadStopsAtCartridgeSize)
+{
+    EXPECT_CALL(fileIO, openFile(fileName))
+        .WillOnce(Return(fd));
+
+    std::vector<uint8_t> buffer(512, 7);
+    EXPECT_CALL(fileIO, readFile(_, fd))
+        .WillRepeatedly(DoAll(SetArrayArgument<0>(buffer.begin(), buffer.end()),
+                              Return(buffer.size())));
+
+    EXPECT_CALL(fileIO, closeFile(fd));
+
+    RomLoader romLoader(fileIO);
+    EXPECT_TRUE(romLoader.load(fileName));
+    size_t const maxSize = IMemory::maxCartridgeSize;
+    EXPECT_EQ(maxSize, romLoader.getData().size());
+    EXPECT_EQ(7, romLoader.getData()[maxSize - 1]);
+}
+
+TEST_F (RomLoaderTest, mapRomFile)
+{
+    char path[] = "/tmp/gbRomXXXXXX";
+    int tmpFd = mkstemp(path);
+    ASSERT_LE(0, tmpFd);
+    std::vector<uint8_t> rom(0x8000);
+    for (size_t index = 0; index < rom.size(); index++) {
+        rom[index] = index * 7;
+    }
+    ASSERT_EQ(static_cast<ssize_t>(rom.size()), write(tmpFd, rom.data(), rom.size()));
+    close(tmpFd);
+
+    FileIO realFileIO;
+    int mapFd = realFileIO.openFile(path);
+    std::shared_ptr<MappedFile> mappedFile = realFileIO.mapFile(mapFd);
+    realFileIO.closeFile(mapFd);
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_EQ(rom.size(), mappedFile->getSize());
+    EXPECT_TRUE(std::equal(rom.begin(), rom.end(), mappedFile->getData()));
+
+    RomLoader romLoader(realFileIO);
+    EXPECT_TRUE(romLoader.load(path));
+    unlink(path);
+    IMemory::CartridgeData data = romLoader.getData();
+    EXPECT_EQ(rom.size(), data.size());
+    EXPECT_TRUE(std::equal(rom.begin(), rom.end(), data.begin()));
+}
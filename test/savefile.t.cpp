@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <unistd.h>
+
+#include "savefile.hpp"
+
+class SaveFileTest : public ::testing::Test
+{
+public:
+    SaveFileTest()
+    {
+        int fd = mkstemp(_path);
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    ~SaveFileTest()
+    {
+        unlink(_path);
+    }
+
+    std::vector<uint8_t> readFile()
+    {
+        std::ifstream file(_path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                                    std::istreambuf_iterator<char>());
+    }
+
+    char _path[20] = "/tmp/gbSaveXXXXXX";
+};
+
+TEST_F (SaveFileTest, pathIsNextToTheRom)
+{
+    EXPECT_EQ("roms/tetris.sav", SaveFile::getPath("roms/tetris.gb"));
+    EXPECT_EQ("roms.d/tetris.sav", SaveFile::getPath("roms.d/tetris"));
+    EXPECT_EQ("tetris.v1.sav", SaveFile::getPath("tetris.v1.gbc"));
+}
+
+TEST_F (SaveFileTest, keepsTheBytesSaved)
+{
+    {
+        SaveFile saveFile;
+        ASSERT_TRUE(saveFile.open(_path, 0x2000));
+        EXPECT_FALSE(saveFile.open(_path, 0x2000));
+        EXPECT_EQ(0x2000u, saveFile.getSize());
+        saveFile.getData()[0x1234] = 0x42;
+        saveFile.markDirty(0x1234);
+        EXPECT_TRUE(saveFile.isDirty());
+        saveFile.flush();
+        EXPECT_FALSE(saveFile.isDirty());
+        EXPECT_EQ(1u, saveFile.getFlushedPages());
+    }
+    std::vector<uint8_t> saved = readFile();
+    ASSERT_EQ(0x2000u, saved.size());
+    EXPECT_EQ(0x42, saved[0x1234]);
+
+    //grown to the larger ram, the saved bytes stay
+    SaveFile saveFile;
+    ASSERT_TRUE(saveFile.open(_path, 0x8000));
+    EXPECT_EQ(0x42, saveFile.getData()[0x1234]);
+    EXPECT_EQ(0x8000u, readFile().size());
+}
+
+TEST_F (SaveFileTest, onlyDirtyPagesAreFlushed)
+{
+    //128KB, the largest cartridge ram
+    SaveFile saveFile;
+    ASSERT_TRUE(saveFile.open(_path, 0x20000));
+    saveFile.flush();
+    EXPECT_EQ(0u, saveFile.getFlushedPages());
+    saveFile.markDirty(0);
+    saveFile.markDirty(1);
+    saveFile.markDirty(0x1ffff);
+    saveFile.flush();
+    EXPECT_EQ(2u, saveFile.getFlushedPages());
+}
+
+TEST_F (SaveFileTest, flushesOnItsOwnThread)
+{
+    SaveFile saveFile(std::chrono::milliseconds(5));
+    ASSERT_TRUE(saveFile.open(_path, 0x2000));
+    saveFile.getData()[0] = 0x24;
+    saveFile.markDirty(0);
+    //the bits are cleared before the pages are synced
+    for (int wait = 0; wait < 1000 && saveFile.getFlushedPages() == 0; wait++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_FALSE(saveFile.isDirty());
+    EXPECT_EQ(1u, saveFile.getFlushedPages());
+    EXPECT_EQ(0x24, readFile()[0]);
+}
+
+TEST_F (SaveFileTest, stopsWithoutWaitingForTheInterval)
+{
+    auto start = std::chrono::steady_clock::now();
+    {
+        SaveFile saveFile(std::chrono::hours(1));
+        ASSERT_TRUE(saveFile.open(_path, 0x2000));
+        saveFile.getData()[0] = 0x24;
+        saveFile.markDirty(0);
+    }
+    EXPECT_GT(std::chrono::seconds(10), std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(0x24, readFile()[0]);
+}
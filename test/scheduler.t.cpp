@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "lockstep.hpp"
+
+//the polling reference updates the components after every instruction
+class SchedulerTest : public LockstepTest
+{
+public:
+
+    SchedulerTest()
+        :LockstepTest(Cpu::CORE::INTERPRETER, Cpu::CORE::INTERPRETER, true){}
+};
+
+TEST_P(SchedulerTest, sameStateAsPolling)
+{
+    runInLockstep(GetParam(), 100000);
+}
+
+INSTANTIATE_TEST_CASE_P(CpuInstrs, SchedulerTest, ::testing::ValuesIn(cpuInstrsRoms), getRomTestName);
+
+TEST_F(SchedulerTest, writesWakeTheComponents)
+{
+    BasicScheduler<Memory>& scheduler = *_machine.scheduler;
+    _machine.update(4);
+    _machine.update(4);
+    EXPECT_EQ(IScheduler::_never, scheduler.getDeadline(IScheduler::EVENT::INTERRUPT));
+    EXPECT_LT(8u, scheduler.getDeadline(IScheduler::EVENT::SCANLINE));
+
+    //LYC, IE and the master switch
+    _machine.memory.writeInMemory(0x42, 0xff45);
+    EXPECT_EQ(8u, scheduler.getDeadline(IScheduler::EVENT::SCANLINE));
+    _machine.memory.writeInMemory(0x01, 0xffff);
+    EXPECT_EQ(8u, scheduler.getDeadline(IScheduler::EVENT::INTERRUPT));
+    _machine.update(4);
+    EXPECT_EQ(IScheduler::_never, scheduler.getDeadline(IScheduler::EVENT::INTERRUPT));
+    _machine.interruptHandler.enableMasterSwitch();
+    EXPECT_EQ(12u, scheduler.getDeadline(IScheduler::EVENT::INTERRUPT));
+
+    //the timer only has a deadline once it is on, 16 cycles a tick at 262144 Hz
+    EXPECT_EQ(IScheduler::_never, scheduler.getDeadline(IScheduler::EVENT::TIMER));
+    _machine.memory.writeInMemory(0x05, 0xff07);
+    _machine.update(4);
+    EXPECT_EQ(12u + 16u, scheduler.getDeadline(IScheduler::EVENT::TIMER));
+}
+
+TEST_F(SchedulerTest, haltSkipsToTheTimerInterrupt)
+{
+    BasicScheduler<Memory>& scheduler = *_machine.scheduler;
+    _machine.memory.writeInMemory(0x76, 0xc000);
+    _machine.memory.set16BitRegister(IMemory::REG16BIT::PC, 0xc000);
+    _machine.memory.writeInMemory(0x04, 0xffff);
+    _machine.memory.writeInMemory(0xfe, 0xff05);
+    _machine.memory.writeInMemory(0x05, 0xff07);
+
+    _machine.update(_machine.core->doInstruction(0x76));
+    ASSERT_TRUE(_machine.interruptHandler.isHalted());
+    int events = 0;
+    while (_machine.interruptHandler.isHalted() && events < 100) {
+        _machine.update(scheduler.getCyclesToNextEvent());
+        events++;
+    }
+    //TIMA overflows on its second tick, 16 cycles each
+    EXPECT_FALSE(_machine.interruptHandler.isHalted());
+    EXPECT_EQ(32u, scheduler.getCycles());
+    EXPECT_EQ(0xc001, _machine.memory.get16BitRegister(IMemory::REG16BIT::PC));
+    EXPECT_EQ(0x04, _machine.memory.readInMemory(0xff0f) & 0x04);
+}
+
+TEST_F(SchedulerTest, dividerFollowsTheMasterClock)
+{
+    for (LockstepMachine* machine : {&_reference, &_machine}) {
+        machine->update(4);
+        machine->memory.writeInMemory(0x00, 0xff04);
+        for (int step = 0; step < 250; step++) {
+            machine->update(4);
+        }
+        EXPECT_EQ(1000 >> 8, machine->memory.readInMemory(0xff04));
+    }
+    //no divider event, a halted cpu waits for the scanline with the timer off
+    BasicScheduler<Memory>& scheduler = *_machine.scheduler;
+    EXPECT_EQ(IScheduler::_never, scheduler.getDeadline(IScheduler::EVENT::TIMER));
+    EXPECT_EQ(IScheduler::_never, scheduler.getDeadline(IScheduler::EVENT::INTERRUPT));
+    EXPECT_EQ(scheduler.getDeadline(IScheduler::EVENT::SCANLINE) - scheduler.getCycles(),
+              static_cast<uint64_t>(scheduler.getCyclesToNextEvent()));
+}
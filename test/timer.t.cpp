@@ -12,10 +12,8 @@ class MockMemory : public IMemory
 {
 public:
 
-    MOCK_METHOD0(incrementDividerRegister, void());
     MOCK_METHOD0(incrementScanline, void());
-    MOCK_METHOD0(getCartridge, CartridgeData const());
-    MOCK_METHOD0(getReadOnlyMemory, RomData const());
+    MOCK_METHOD0(getCartridge, CartridgeData const &());
     MOCK_METHOD1(setCartridge, bool(CartridgeData const &));
     MOCK_METHOD0(getState, IMemory::State());
     MOCK_METHOD0(initializeMemory, void());
@@ -68,8 +66,8 @@ TEST_F(TimerTest, updateTimerWithClockDisabled)
     Timer timer(_memory, _interruptHandler);
     EXPECT_CALL(_memory, readInMemory(0xff07))
         .WillOnce(Return(0x00)); //clock disabled
-    EXPECT_CALL(_memory, incrementDividerRegister());
     timer.update(1024);
+    EXPECT_EQ(4, timer.readIo(0xff04, 0x00));
 }
 
 TEST_F(TimerTest, updateTimerWithClockEnabledAndWithOverflow)
@@ -79,7 +77,6 @@ TEST_F(TimerTest, updateTimerWithClockEnabledAndWithOverflow)
     EXPECT_CALL(_memory, readInMemory(0xff07))
         .WillOnce(Return(0x04)) //clock enabled
         .WillOnce(Return(0x00));//for set frequency
-    EXPECT_CALL(_memory, incrementDividerRegister());
     EXPECT_CALL(_memory, readInMemory(0xff05))
         .WillOnce(Return(0xff));
     EXPECT_CALL(_memory, readInMemory(0xff06))
@@ -151,3 +148,21 @@ TEST_F(TimerTest, setClockFrequency)
         EXPECT_EQ(256, timer.setClockFrequency());
     }
 }
+
+TEST_F(TimerTest, dividerCountsTheCyclesSinceItsReset)
+{
+    Timer timer(_memory, _interruptHandler);
+    EXPECT_CALL(_memory, readInMemory(0xff07))
+        .WillRepeatedly(Return(0x00));
+    timer.update(255);
+    EXPECT_EQ(0, timer.readIo(0xff04, 0x00));
+    timer.update(1);
+    EXPECT_EQ(1, timer.readIo(0xff04, 0x00));
+    timer.update(0x100 * 0x100);
+    EXPECT_EQ(1, timer.readIo(0xff04, 0x00));
+
+    //any write resets it
+    EXPECT_EQ(0, timer.writeIo(0xff04, 0x42, 0x00));
+    timer.update(0x1ff);
+    EXPECT_EQ(1, timer.readIo(0xff04, 0x00));
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "tracesink.hpp"
+#include "log.hpp"
+
+TEST(TraceSinkTest, writesOneRecordPerInstruction)
+{
+    std::string const fileName = ::testing::TempDir() + "tracesink.t.bin";
+    Registers registers{};
+    {
+        TraceSink traceSink(fileName);
+        ASSERT_TRUE(traceSink.isOpen());
+        for (size_t step = 0; step < TraceSink::_bufferSize + 3; step++) {
+            registers.pc = step;
+            registers.a = step & 0xff;
+            traceSink.record(registers, 0x3C);
+        }
+        EXPECT_EQ(TraceSink::_bufferSize + 3, traceSink.getRecordCount());
+    }
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<TraceSink::Record> records(TraceSink::_bufferSize + 3);
+    file.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(TraceSink::Record));
+    EXPECT_EQ(static_cast<std::streamsize>(records.size() * sizeof(TraceSink::Record)), file.gcount());
+    EXPECT_EQ(0x4002, records.back().registers.pc);
+    EXPECT_EQ(0x02, records.back().registers.a);
+    EXPECT_EQ(0x3C, records.back().opCode);
+    std::remove(fileName.c_str());
+}
+
+TEST(TraceSinkTest, logsBelowLevelAreCompiledOut)
+{
+    int evaluations = 0;
+    auto count = [&evaluations]() { return ++evaluations; };
+    GB_LOG(trace) << count();
+    EXPECT_EQ(0, evaluations);
+}